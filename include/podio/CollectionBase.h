@@ -2,6 +2,7 @@
 #define PODIO_COLLECTIONBASE_H
 
 #include "podio/CollectionBuffers.h"
+#include "podio/MemoryUsage.h"
 #include "podio/ObjectID.h"
 #include "podio/SchemaEvolution.h"
 
@@ -37,6 +38,10 @@ public:
   /// re-create collection from buffers after read
   virtual void prepareAfterRead() = 0;
 
+  /// release the I/O buffers that are no longer necessary after
+  /// prepareAfterRead. They are re-created by prepareForWrite if necessary
+  virtual void releaseIOBuffers() = 0;
+
   /// initialize references after read
   virtual bool setReferences(const ICollectionProvider* collectionProvider) = 0;
 
@@ -84,6 +89,11 @@ public:
 
   /// Get the index in the DatatypeRegistry of the EDM this collection belongs to
   virtual size_t getDatamodelRegistryIndex() const = 0;
+
+  /// Get the (approximate) heap memory that is used by this collection. Not
+  /// thread-safe w.r.t. concurrent modifications of the collection (including
+  /// the lazy resolution of relations of read collections)
+  virtual podio::MemoryUsage memoryUsage() const = 0;
 };
 
 } // namespace podio
@@ -54,6 +54,7 @@ struct CollectionReadBuffers {
   using RecastFuncT = std::function<void(CollectionReadBuffers&)>;
 
   using DeleteFuncT = std::function<void(CollectionReadBuffers&)>;
+  using SizeFuncT = std::function<size_t(const CollectionReadBuffers&)>;
 
   CollectionReadBuffers(void* d, CollRefCollection* ref, VectorMembersInfo* vec, SchemaVersionT version,
                         std::string_view typ, CreateFuncT&& createFunc, RecastFuncT&& recastFunc,
@@ -114,6 +115,11 @@ struct CollectionReadBuffers {
   // We need a function that explicitly deletes the buffers, but for this we
   // need type information, so we attach a delete function at generation time
   DeleteFuncT deleteBuffers{};
+
+  // Get the number of elements that are stored in the buffers without having
+  // to create a collection from them (e.g. for summaries of a file). Only
+  // usable after the buffers have been recast (if necessary)
+  SizeFuncT size{};
 };
 
 } // namespace podio
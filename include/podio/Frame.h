@@ -7,16 +7,23 @@
 #include "podio/FrameCategories.h" // mainly for convenience
 #include "podio/GenericParameters.h"
 #include "podio/ICollectionProvider.h"
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
+#include "podio/MemoryUsage.h"
 #include "podio/SchemaEvolution.h"
+#include "podio/Tracing.h"
 #include "podio/utilities/TypeHelpers.h"
 
+#include <exception>
+#include <future>
 #include <initializer_list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -59,6 +66,34 @@ namespace detail {
       return std::make_unique<podio::GenericParameters>();
     }
   };
+
+  template <typename FrameDataT>
+  using hasIOStats_t = decltype(std::declval<const FrameDataT&>().getIOStats());
+
+  /// Get the recorder for the I/O statistics if the FrameData offers one and
+  /// the statistics are enabled, otherwise a nullptr
+  template <typename FrameDataT>
+  const podio::IOStatsRecorder* getIOStatsRecorder([[maybe_unused]] const FrameDataT* data) {
+    if constexpr (det::is_detected_v<hasIOStats_t, FrameDataT>) {
+      if (data && data->getIOStats()) {
+        return &data->getIOStats();
+      }
+    }
+    return nullptr;
+  }
+
+  template <typename FrameDataT>
+  using hasIOBufferPolicy_t = decltype(std::declval<const FrameDataT&>().getIOBufferPolicy());
+
+  /// Check whether the FrameData wants the I/O buffers of collections to be
+  /// released after they have been unpacked. Keep them by default
+  template <typename FrameDataT>
+  bool releaseIOBuffers([[maybe_unused]] const FrameDataT* data) {
+    if constexpr (det::is_detected_v<hasIOBufferPolicy_t, FrameDataT>) {
+      return data && data->getIOBufferPolicy() == podio::IOBufferPolicy::Release;
+    }
+    return false;
+  }
 } // namespace detail
 
 template <typename FrameDataT>
@@ -77,12 +112,17 @@ class Frame {
   struct FrameConcept {
     virtual ~FrameConcept() = default;
     virtual const podio::CollectionBase* get(const std::string& name) const = 0;
+    virtual const podio::CollectionBase* getForWrite(const std::string& name) const = 0;
     virtual const podio::CollectionBase* put(std::unique_ptr<podio::CollectionBase> coll, const std::string& name) = 0;
     virtual podio::GenericParameters& parameters() = 0;
     virtual const podio::GenericParameters& parameters() const = 0;
 
     virtual std::vector<std::string> availableCollections() const = 0;
 
+    virtual std::optional<std::string> getName(uint32_t collectionID) const = 0;
+
+    virtual std::map<std::string, podio::MemoryUsage> memoryUsage() const = 0;
+
     // Writing interface. Need this to be able to store all necessary information
     // TODO: Figure out whether this can be "hidden" somehow
     virtual podio::CollectionIDTable getIDTable() const = 0;
@@ -107,6 +147,14 @@ class Frame {
      */
     const podio::CollectionBase* get(const std::string& name) const final;
 
+    /** Get a collection for writing it. Collections that are still only
+     * available as raw data are created from their buffers without unpacking
+     * them (i.e. prepareAfterRead and setReferences are not called), since the
+     * buffers can be written as they are. Unpacking happens only if the
+     * collection is retrieved via get later.
+     */
+    const podio::CollectionBase* getForWrite(const std::string& name) const final;
+
     /** Try and place the collection into the internal storage and return a
      * pointer to it. If a collection already exists or insertion fails, return
      * a nullptr
@@ -133,22 +181,55 @@ class Frame {
 
     std::vector<std::string> availableCollections() const override;
 
+    std::optional<std::string> getName(uint32_t collectionID) const override {
+      return m_idTable.name(collectionID);
+    }
+
+    std::map<std::string, podio::MemoryUsage> memoryUsage() const override;
+
   private:
-    podio::CollectionBase* doGet(const std::string& name, bool setReferences = true) const;
+    podio::CollectionBase* doGet(const std::string& name) const;
+
+    /// Unpack the collection (creating it from the raw data first if coll is
+    /// a nullptr) and put it into the internal map
+    podio::CollectionBase* unpackCollection(const std::string& name, std::unique_ptr<podio::CollectionBase> coll) const;
+
+    /// Create a collection from the raw data (if available) without unpacking it
+    std::unique_ptr<podio::CollectionBase> createFromRawData(const std::string& name) const;
+
+    /// A collection that is currently being unpacked (or created for writing)
+    /// by the owner thread. Other threads wait for the result instead of
+    /// retrieving the raw data again
+    struct Unpacking {
+      std::thread::id owner{}; ///< The unpacking thread (default constructed if unpacking failed)
+      std::shared_future<podio::CollectionBase*> result{};
+      bool forWrite{false}; ///< Whether the collection is only created for writing, i.e. not unpacked
+    };
+
+    /// Get the unpacking of the collection that is currently done by another
+    /// thread (or that has failed). Needs m_mapMtx to be locked
+    const Unpacking* unpackingElsewhere(const std::string& name) const {
+      if (const auto it = m_unpacking.find(name); it != m_unpacking.end()) {
+        return it->second.owner == std::this_thread::get_id() ? nullptr : &it->second;
+      }
+      return nullptr;
+    }
 
     using CollectionMapT = std::unordered_map<std::string, std::unique_ptr<podio::CollectionBase>>;
 
     mutable CollectionMapT m_collections{};                 ///< The internal map for storing unpacked collections
+    mutable CollectionMapT m_packedCollections{};           ///< Collections that have only been retrieved for writing
     mutable std::unique_ptr<std::mutex> m_mapMtx{nullptr};  ///< The mutex for guarding the internal collection map
     std::unique_ptr<FrameDataT> m_data{nullptr};            ///< The raw data read from file
     mutable std::unique_ptr<std::mutex> m_dataMtx{nullptr}; ///< The mutex for guarding the raw data
     podio::CollectionIDTable m_idTable{};                   ///< The collection ID table
     std::unique_ptr<podio::GenericParameters> m_parameters{nullptr}; ///< The generic parameter store for this frame
-    mutable std::set<uint32_t> m_retrievedIDs{}; ///< The IDs of the collections that we have already read (but not yet
-                                                 ///< put into the map)
+    mutable std::unordered_map<std::string, Unpacking> m_unpacking{}; ///< The collections that are being unpacked
   };
 
-  std::unique_ptr<FrameConcept> m_self; ///< The internal concept pointer through which all the work is done
+  /// The internal concept pointer through which all the work is done. Shared
+  /// only (weakly) with the tasks started by prefetch
+  std::shared_ptr<FrameConcept> m_self;
 
 public:
   /** Empty Frame constructor
@@ -188,6 +269,19 @@ public:
    */
   const podio::CollectionBase* get(const std::string& name) const;
 
+  /** Start unpacking the collections with the given names asynchronously, such
+   * that they are (ideally) ready once they are retrieved via get.
+   *
+   * The executor is called once for each collection with a callable without
+   * arguments that does the unpacking, which it has to run at some point, e.g.
+   * on a thread pool. Calling get for a collection that is currently being
+   * unpacked waits until it is ready. Exceptions that are thrown while
+   * unpacking are rethrown by get. Tasks that only run after the Frame has
+   * been destroyed do nothing.
+   */
+  template <typename ExecutorT>
+  void prefetch(const std::vector<std::string>& names, ExecutorT&& executor) const;
+
   /** (Destructively) move a collection into the Frame and get a const reference
    * back for further use
    */
@@ -257,14 +351,41 @@ public:
     return m_self->availableCollections();
   }
 
+  /** Get the name of the collection with the given collection ID (if there is
+   * such a collection in this Frame)
+   */
+  std::optional<std::string> getName(uint32_t collectionID) const {
+    return m_self->getName(collectionID);
+  }
+
+  /** Get the (approximate) heap memory that is used by all collections that
+   * currently live in this Frame (see podio::MemoryUsage). Collections that
+   * have not yet been retrieved from the raw data are not included
+   */
+  podio::MemoryUsage memoryUsage() const {
+    auto usage = podio::MemoryUsage{};
+    for (const auto& [_, collUsage] : m_self->memoryUsage()) {
+      usage += collUsage;
+    }
+    return usage;
+  }
+
+  /** Get the (approximate) heap memory that is used by each collection that
+   * currently lives in this Frame
+   */
+  std::map<std::string, podio::MemoryUsage> getCollectionMemoryUsage() const {
+    return m_self->memoryUsage();
+  }
+
   // Interfaces for writing below
   // TODO: Hide this from the public interface somehow?
   /**
    * Get a collection for writing (in a prepared and "ready-to-write" state)
    */
   const podio::CollectionBase* getCollectionForWrite(const std::string& name) const {
-    const auto* coll = m_self->get(name);
+    const auto* coll = m_self->getForWrite(name);
     if (coll) {
+      const auto span = podio::TraceSpan("prepareForWrite", "frame", name);
       coll->prepareForWrite();
     }
 
@@ -282,7 +403,7 @@ inline Frame::Frame() : Frame(std::make_unique<detail::EmptyFrameData>()) {
 }
 
 template <typename FrameDataT>
-Frame::Frame(std::unique_ptr<FrameDataT> data) : m_self(std::make_unique<FrameModel<FrameDataT>>(std::move(data))) {
+Frame::Frame(std::unique_ptr<FrameDataT> data) : m_self(std::make_shared<FrameModel<FrameDataT>>(std::move(data))) {
 }
 
 template <typename FrameDataT, typename>
@@ -304,6 +425,21 @@ inline const podio::CollectionBase* Frame::get(const std::string& name) const {
   return m_self->get(name);
 }
 
+template <typename ExecutorT>
+void Frame::prefetch(const std::vector<std::string>& names, ExecutorT&& executor) const {
+  for (const auto& name : names) {
+    executor([self = std::weak_ptr<const FrameConcept>(m_self), name]() {
+      if (const auto frame = self.lock()) {
+        try {
+          frame->get(name);
+        } catch (...) {
+          // Kept by the Frame and rethrown when the collection is retrieved
+        }
+      }
+    });
+  }
+}
+
 inline void Frame::put(std::unique_ptr<podio::CollectionBase> coll, const std::string& name) {
   const auto* retColl = m_self->put(std::move(coll), name);
   if (!retColl) {
@@ -337,56 +473,199 @@ const podio::CollectionBase* Frame::FrameModel<FrameDataT>::get(const std::strin
 }
 
 template <typename FrameDataT>
-podio::CollectionBase* Frame::FrameModel<FrameDataT>::doGet(const std::string& name, bool setReferences) const {
+const podio::CollectionBase* Frame::FrameModel<FrameDataT>::getForWrite(const std::string& name) const {
+  auto promise = std::promise<podio::CollectionBase*>{};
   {
-    // First check whether the collection is in the map already
-    //
+    std::unique_lock lock{*m_mapMtx};
+    // Both, an unpacked collection and one that has only been created for
+    // writing, can be written
+    if (const auto* unpacking = unpackingElsewhere(name)) {
+      auto result = unpacking->result;
+      lock.unlock();
+      return result.get();
+    }
+    if (const auto it = m_collections.find(name); it != m_collections.end()) {
+      return it->second.get();
+    }
+    if (const auto it = m_packedCollections.find(name); it != m_packedCollections.end()) {
+      return it->second.get();
+    }
+    if (m_unpacking.count(name)) {
+      return nullptr;
+    }
+    m_unpacking.emplace(name, Unpacking{std::this_thread::get_id(), promise.get_future().share(), true});
+  }
+
+  std::unique_ptr<podio::CollectionBase> coll{nullptr};
+  try {
+    coll = createFromRawData(name);
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    // Keep the failure for all later calls, since the raw data are gone
+    std::lock_guard lock{*m_mapMtx};
+    m_unpacking[name].owner = std::thread::id{};
+    throw;
+  }
+
+  podio::CollectionBase* retColl = nullptr;
+  std::lock_guard lock{*m_mapMtx};
+  if (coll) {
+    retColl = m_packedCollections.emplace(name, std::move(coll)).first->second.get();
+  }
+  m_unpacking.erase(name);
+  promise.set_value(retColl);
+  return retColl;
+}
+
+template <typename FrameDataT>
+std::unique_ptr<podio::CollectionBase>
+Frame::FrameModel<FrameDataT>::createFromRawData(const std::string& name) const {
+  if (!m_data) {
+    return nullptr;
+  }
+
+  // Have the buffers in the outer scope here to hold the raw data lock as
+  // briefly as possible
+  auto buffers = std::optional<podio::CollectionReadBuffers>{std::nullopt};
+  {
+    std::lock_guard lock{*m_dataMtx};
+    buffers = unpack(m_data.get(), name);
+  }
+  if (!buffers) {
+    return nullptr;
+  }
+
+  std::unique_ptr<podio::CollectionBase> coll{nullptr};
+  // Subset collections do not need schema evolution (by definition)
+  if (buffers->data == nullptr) {
+    coll = buffers->createCollection(buffers.value(), true);
+  } else {
+    auto evolvedBuffers = podio::SchemaEvolution::instance().evolveBuffers(buffers.value(), buffers->schemaVersion,
+                                                                           std::string(buffers->type));
+    coll = evolvedBuffers.createCollection(evolvedBuffers, false);
+  }
+  coll->setID(m_idTable.collectionID(name).value());
+
+  return coll;
+}
+
+template <typename FrameDataT>
+podio::CollectionBase* Frame::FrameModel<FrameDataT>::doGet(const std::string& name) const {
+  std::unique_ptr<podio::CollectionBase> coll{nullptr};
+  auto promise = std::promise<podio::CollectionBase*>{};
+  {
+    std::unique_lock lock{*m_mapMtx};
+    // If another thread is currently unpacking this collection (e.g. due to a
+    // prefetch) wait for it, since the raw data can only be unpacked once. The
+    // unpacking thread itself only ends up here via setReferences, in which
+    // case the collection is already in the map
+    while (const auto* unpacking = unpackingElsewhere(name)) {
+      auto result = unpacking->result;
+      const auto forWrite = unpacking->forWrite;
+      lock.unlock();
+      podio::CollectionBase* waitedFor = nullptr;
+      {
+        const auto span = podio::TraceSpan("Frame::waitForUnpack", "frame", name);
+        waitedFor = result.get();
+      }
+      if (!forWrite) {
+        return waitedFor;
+      }
+      // A collection that has only been created for writing still has to be
+      // unpacked, which the first thread to get here does below
+      lock.lock();
+    }
+
     // Collections only land here if they are fully unpacked, i.e.
     // prepareAfterRead has been called or it has been put into the Frame
-    std::lock_guard lock{*m_mapMtx};
     if (const auto it = m_collections.find(name); it != m_collections.end()) {
       return it->second.get();
     }
+    if (m_unpacking.count(name)) {
+      return nullptr;
+    }
+    // Collections that have only been retrieved for writing so far still have
+    // to be unpacked
+    if (auto it = m_packedCollections.find(name); it != m_packedCollections.end()) {
+      coll = std::move(it->second);
+      m_packedCollections.erase(it);
+    }
+    m_unpacking.emplace(name, Unpacking{std::this_thread::get_id(), promise.get_future().share()});
   }
 
   podio::CollectionBase* retColl = nullptr;
+  try {
+    retColl = unpackCollection(name, std::move(coll));
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    // Keep the failure for all later calls, since the raw data are gone
+    std::lock_guard lock{*m_mapMtx};
+    m_unpacking[name].owner = std::thread::id{};
+    throw;
+  }
+
+  promise.set_value(retColl);
+  std::lock_guard lock{*m_mapMtx};
+  m_unpacking.erase(name);
+  return retColl;
+}
 
-  // Now try to get it from the raw data if we have the possibility
-  if (m_data) {
-    // Have the buffers in the outer scope here to hold the raw data lock as
-    // briefly as possible
-    auto buffers = std::optional<podio::CollectionReadBuffers>{std::nullopt};
-    {
-      std::lock_guard lock{*m_dataMtx};
-      buffers = unpack(m_data.get(), name);
+template <typename FrameDataT>
+podio::CollectionBase*
+Frame::FrameModel<FrameDataT>::unpackCollection(const std::string& name,
+                                                std::unique_ptr<podio::CollectionBase> coll) const {
+  // Only unpacking is traced, as getting already unpacked collections is cheap
+  const auto span = podio::TraceSpan("Frame::unpack", "frame", name);
+  if (!coll) {
+    coll = createFromRawData(name);
+  }
+  if (!coll) {
+    return nullptr;
+  }
+
+  const auto* ioStats = detail::getIOStatsRecorder(m_data.get());
+  auto collStats = podio::CollectionIOStats{};
+  auto start = podio::IOStatsRecorder::Clock::time_point{};
+  if (ioStats) {
+    start = podio::IOStatsRecorder::Clock::now();
+  }
+  {
+    const auto prepareSpan = podio::TraceSpan("prepareAfterRead", "frame", name);
+    coll->prepareAfterRead();
+    if (detail::releaseIOBuffers(m_data.get())) {
+      coll->releaseIOBuffers();
     }
-    if (buffers) {
-      std::unique_ptr<podio::CollectionBase> coll{nullptr};
-      // Subset collections do not need schema evolution (by definition)
-      if (buffers->data == nullptr) {
-        coll = buffers->createCollection(buffers.value(), true);
-      } else {
-        auto evolvedBuffers = podio::SchemaEvolution::instance().evolveBuffers(buffers.value(), buffers->schemaVersion,
-                                                                               std::string(buffers->type));
-        coll = evolvedBuffers.createCollection(evolvedBuffers, false);
-      }
+  }
+  if (ioStats) {
+    collStats.prepareTime = podio::IOStatsRecorder::elapsedSince(start);
+  }
 
-      coll->prepareAfterRead();
-      coll->setID(m_idTable.collectionID(name).value());
-      {
-        std::lock_guard mapLock{*m_mapMtx};
-        auto [it, success] = m_collections.emplace(name, std::move(coll));
-        // TODO: Check success? Or simply assume that everything is fine at this point?
-        // TODO: Collision handling?
-        retColl = it->second.get();
-      }
+  podio::CollectionBase* retColl = nullptr;
+  {
+    std::lock_guard mapLock{*m_mapMtx};
+    auto [it, success] = m_collections.emplace(name, std::move(coll));
+    // TODO: Check success? Or simply assume that everything is fine at this point?
+    // TODO: Collision handling?
+    retColl = it->second.get();
+  }
 
-      if (setReferences) {
-        retColl->setReferences(this);
-      }
+  // This does not yet resolve any relations, but only prepares everything
+  // such that they can be resolved once they are accessed for the first time
+  {
+    if (ioStats) {
+      start = podio::IOStatsRecorder::Clock::now();
+    }
+    const auto refSpan = podio::TraceSpan("setReferences", "frame", name);
+    retColl->setReferences(this);
+    if (ioStats) {
+      collStats.setReferencesTime = podio::IOStatsRecorder::elapsedSince(start);
     }
   }
 
+  if (ioStats) {
+    ioStats->add(name, collStats);
+  }
+
   return retColl;
 }
 
@@ -396,20 +675,12 @@ bool Frame::FrameModel<FrameDataT>::get(uint32_t collectionID, CollectionBase*&
   if (!name) {
     return false;
   }
-  const auto& [_, inserted] = m_retrievedIDs.insert(collectionID);
-
-  if (inserted) {
-    auto coll = doGet(name.value());
-    if (coll) {
-      collection = coll;
-      return true;
-    }
-  } else {
-    auto coll = doGet(name.value(), false);
-    if (coll) {
-      collection = coll;
-      return true;
-    }
+  // Relations are resolved lazily and can hence trigger this from several
+  // threads concurrently. The unpacking in doGet makes sure that every
+  // collection is unpacked (and setReferences is called) exactly once
+  if (auto coll = doGet(name.value())) {
+    collection = coll;
+    return true;
   }
 
   return false;
@@ -436,6 +707,21 @@ const podio::CollectionBase* Frame::FrameModel<FrameDataT>::put(std::unique_ptr<
   return nullptr;
 }
 
+template <typename FrameDataT>
+std::map<std::string, podio::MemoryUsage> Frame::FrameModel<FrameDataT>::memoryUsage() const {
+  std::map<std::string, podio::MemoryUsage> usage;
+  std::lock_guard lock{*m_mapMtx};
+  for (const auto& [name, coll] : m_collections) {
+    usage.emplace(name, coll->memoryUsage());
+  }
+  // Collections that have only been retrieved for writing keep their I/O
+  // buffers alive
+  for (const auto& [name, coll] : m_packedCollections) {
+    usage.emplace(name, coll->memoryUsage());
+  }
+  return usage;
+}
+
 template <typename FrameDataT>
 std::vector<std::string> Frame::FrameModel<FrameDataT>::availableCollections() const {
   // TODO: Check if there is a more efficient way to do this. Currently this is
@@ -453,6 +739,9 @@ std::vector<std::string> Frame::FrameModel<FrameDataT>::availableCollections() c
   for (const auto& [name, _] : m_collections) {
     collections.push_back(name);
   }
+  for (const auto& [name, _] : m_packedCollections) {
+    collections.push_back(name);
+  }
 
   return collections;
 }
@@ -0,0 +1,135 @@
+#ifndef PODIO_FRAMECACHE_H
+#define PODIO_FRAMECACHE_H
+
+#include "podio/Frame.h"
+#include "podio/ObjectID.h"
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace podio {
+
+/**
+ * Identifier of an object that can be resolved across Frames. The ObjectID of
+ * an object is only unique within the Frame that holds its collection, hence it
+ * is combined with a key that identifies that Frame (e.g. the entry number of a
+ * "timeslices" Frame that is referenced from several "events" Frames).
+ */
+struct FrameObjectID {
+  /// key of the Frame that holds the object
+  uint64_t frameKey{};
+  /// ID of the object inside that Frame
+  podio::ObjectID objectID{};
+
+  bool operator==(const FrameObjectID& other) const {
+    return frameKey == other.frameKey && objectID == other.objectID;
+  }
+  bool operator!=(const FrameObjectID& other) const {
+    return !(*this == other);
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const podio::FrameObjectID& id) {
+  return os << id.frameKey << ":" << id.objectID;
+}
+
+/// Create the FrameObjectID for an object that is stored in the Frame with the
+/// given key
+template <typename T>
+FrameObjectID makeFrameObjectID(uint64_t frameKey, const T& obj) {
+  return {frameKey, obj.getObjectID()};
+}
+
+/**
+ * A cache of Frames that makes it possible to resolve FrameObjectIDs, i.e.
+ * references to objects that are stored in another Frame. This allows to keep
+ * (large) collections in only one Frame and to refer to their objects from
+ * other Frames without having to copy them.
+ *
+ * The cache owns the Frames that are put into it. Putting Frames into and
+ * getting or resolving objects from the cache can be done from several threads
+ * concurrently. Objects that have been resolved from a Frame remain valid only
+ * as long as that Frame is in the cache.
+ */
+class FrameCache {
+public:
+  FrameCache() = default;
+  FrameCache(const FrameCache&) = delete;
+  FrameCache& operator=(const FrameCache&) = delete;
+  FrameCache(FrameCache&&) = delete;
+  FrameCache& operator=(FrameCache&&) = delete;
+  ~FrameCache() = default;
+
+  /// Move a Frame into the cache under the given key and get a const reference
+  /// to it back. Throws a std::invalid_argument if there already is a Frame
+  /// with this key in the cache
+  const podio::Frame& put(uint64_t frameKey, podio::Frame&& frame) {
+    std::unique_lock lock{m_mutex};
+    const auto [it, inserted] = m_frames.try_emplace(frameKey, std::move(frame));
+    if (!inserted) {
+      throw std::invalid_argument("FrameCache already contains a Frame with key " + std::to_string(frameKey));
+    }
+    return it->second;
+  }
+
+  /// Get the Frame with the given key, or a nullptr if there is no such Frame
+  const podio::Frame* get(uint64_t frameKey) const {
+    std::shared_lock lock{m_mutex};
+    if (const auto it = m_frames.find(frameKey); it != m_frames.end()) {
+      return &it->second;
+    }
+    return nullptr;
+  }
+
+  /// Remove the Frame with the given key from the cache. Returns whether there
+  /// was such a Frame
+  bool erase(uint64_t frameKey) {
+    std::unique_lock lock{m_mutex};
+    return m_frames.erase(frameKey) > 0;
+  }
+
+  /// The number of Frames in the cache
+  size_t size() const {
+    std::shared_lock lock{m_mutex};
+    return m_frames.size();
+  }
+
+  /// Resolve a FrameObjectID to an object of type T. Returns an empty object if
+  /// the Frame is not in the cache, if the Frame does not have the collection,
+  /// if the collection is not of the expected type, or if there is no object
+  /// with this index in the collection.
+  template <typename T>
+  T resolve(const FrameObjectID& id) const {
+    using CollT = typename T::collection_type;
+
+    std::shared_lock lock{m_mutex};
+    const auto it = m_frames.find(id.frameKey);
+    if (it == m_frames.end()) {
+      return T::makeEmpty();
+    }
+    const auto& frame = it->second;
+    const auto name = frame.getName(id.objectID.collectionID);
+    if (!name) {
+      return T::makeEmpty();
+    }
+    const auto* coll = dynamic_cast<const CollT*>(frame.get(name.value()));
+    if (!coll || id.objectID.index < 0 || static_cast<size_t>(id.objectID.index) >= coll->size()) {
+      return T::makeEmpty();
+    }
+    return (*coll)[id.objectID.index];
+  }
+
+private:
+  mutable std::shared_mutex m_mutex{};                   ///< The mutex guarding the Frames
+  std::unordered_map<uint64_t, podio::Frame> m_frames{}; ///< The Frames in the cache
+};
+
+} // namespace podio
+
+#endif // PODIO_FRAMECACHE_H
@@ -0,0 +1,128 @@
+#ifndef PODIO_FRAMECONVERTER_H
+#define PODIO_FRAMECONVERTER_H
+
+#include "podio/Frame.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Write all Frames of the given categories from a reader to a writer, e.g. to
+ * convert a file from one backend to another.
+ *
+ * The collections are not unpacked for this, i.e. the buffers that have been
+ * read are handed to the writer as they are. Reading happens on a background
+ * thread that reads up to prefetch Frames ahead, such that reading (and
+ * decompressing) the next Frames overlaps with writing (and compressing) the
+ * current one. NOTE: Hence, for the ROOT based readers and writers
+ * ROOT::EnableThreadSafety has to be called before converting Frames.
+ *
+ * The ReaderT can be any reader offering
+ * std::unique_ptr<FrameDataT> readNextEntry(const std::string&) and
+ * std::vector<std::string_view> getAvailableCategories(). The WriterT can be
+ * any writer offering writeFrame(const podio::Frame&, const std::string&).
+ *
+ * @param reader     The reader from which the Frames are read. Must not be used
+ *                   otherwise during the conversion
+ * @param writer     The writer to which the Frames are written. finish() is not
+ *                   called on it
+ * @param categories The categories to convert. All available categories if
+ *                   empty
+ * @param prefetch   The maximum number of Frames that are read ahead
+ *
+ * @returns The number of converted Frames
+ *
+ * @throws Rethrows exceptions that happened while reading or writing
+ */
+template <typename ReaderT, typename WriterT>
+size_t convertFrames(ReaderT& reader, WriterT& writer, std::vector<std::string> categories = {},
+                     size_t prefetch = 16) {
+  if (prefetch == 0) {
+    throw std::invalid_argument("prefetch has to be larger than 0");
+  }
+  if (categories.empty()) {
+    for (const auto& cat : reader.getAvailableCategories()) {
+      categories.emplace_back(cat);
+    }
+  }
+
+  using FrameDataPtr = decltype(reader.readNextEntry(categories.front()));
+  std::mutex mutex{}; // guards everything below that is shared between the threads
+  std::condition_variable spaceCond{};
+  std::condition_variable readyCond{};
+  // The read Frames together with the index of their category
+  std::deque<std::pair<size_t, FrameDataPtr>> queue{};
+  bool doneReading{false};
+  bool stop{false};
+  std::exception_ptr readError{nullptr};
+
+  std::thread readThread([&]() {
+    try {
+      for (size_t i = 0; i < categories.size(); ++i) {
+        while (auto data = reader.readNextEntry(categories[i])) {
+          std::unique_lock lock{mutex};
+          spaceCond.wait(lock, [&]() { return stop || queue.size() < prefetch; });
+          if (stop) {
+            return;
+          }
+          queue.emplace_back(i, std::move(data));
+          lock.unlock();
+          readyCond.notify_one();
+        }
+      }
+    } catch (...) {
+      readError = std::current_exception();
+    }
+    {
+      std::lock_guard lock{mutex};
+      doneReading = true;
+    }
+    readyCond.notify_one();
+  });
+
+  size_t nFrames{0};
+  try {
+    while (true) {
+      std::unique_lock lock{mutex};
+      readyCond.wait(lock, [&]() { return doneReading || !queue.empty(); });
+      if (queue.empty()) {
+        break;
+      }
+      auto [catIndex, data] = std::move(queue.front());
+      queue.pop_front();
+      lock.unlock();
+      spaceCond.notify_one();
+
+      writer.writeFrame(podio::Frame(std::move(data)), categories[catIndex]);
+      ++nFrames;
+    }
+  } catch (...) {
+    {
+      std::lock_guard lock{mutex};
+      stop = true;
+    }
+    spaceCond.notify_one();
+    readThread.join();
+    throw;
+  }
+
+  readThread.join();
+  if (readError) {
+    std::rethrow_exception(readError);
+  }
+  return nFrames;
+}
+
+} // namespace podio
+
+#endif // PODIO_FRAMECONVERTER_H
@@ -0,0 +1,194 @@
+#ifndef PODIO_FRAMEPREFETCHER_H
+#define PODIO_FRAMEPREFETCHER_H
+
+#include "podio/Frame.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Reads the Frames of one category from a reader in batches on background
+ * threads, such that the next batches are already available when they are
+ * requested. After reading, all collections of the Frames are unpacked, so
+ * that no further I/O related work is necessary when they are accessed.
+ *
+ * The reader is only accessed by one thread at a time, in order to keep the
+ * order of the Frames. Unpacking happens concurrently for different batches if
+ * more than one thread is used. The reader must not be used otherwise while
+ * the prefetcher exists.
+ *
+ * The ReaderT can be any reader offering
+ * std::unique_ptr<FrameDataT> readNextEntry(const std::string&)
+ */
+template <typename ReaderT>
+class FramePrefetcher {
+public:
+  /**
+   * Start reading Frames in the background.
+   *
+   * @param reader    The reader from which the Frames are read
+   * @param category  The category of the Frames
+   * @param batchSize The (maximum) number of Frames per batch
+   * @param prefetch  The number of batches that are read ahead
+   * @param nThreads  The number of threads for reading and unpacking
+   */
+  FramePrefetcher(ReaderT& reader, const std::string& category, size_t batchSize, size_t prefetch = 2,
+                  size_t nThreads = 1) :
+      m_reader(reader), m_category(category), m_batchSize(batchSize), m_prefetch(prefetch) {
+    if (batchSize == 0 || prefetch == 0 || nThreads == 0) {
+      throw std::invalid_argument("batchSize, prefetch and nThreads have to be larger than 0");
+    }
+    m_threads.reserve(nThreads);
+    for (size_t i = 0; i < nThreads; ++i) {
+      m_threads.emplace_back([this]() { work(); });
+    }
+  }
+
+  FramePrefetcher(const FramePrefetcher&) = delete;
+  FramePrefetcher& operator=(const FramePrefetcher&) = delete;
+  FramePrefetcher(FramePrefetcher&&) = delete;
+  FramePrefetcher& operator=(FramePrefetcher&&) = delete;
+
+  /// Stops reading further batches and waits for all threads to finish
+  ~FramePrefetcher() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stop = true;
+    }
+    m_spaceCond.notify_all();
+    for (auto& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  /**
+   * Get the next batch of Frames, waiting until it is available.
+   *
+   * @returns The Frames of the next batch in the order in which they are
+   *          stored. An empty batch once all Frames have been read
+   *
+   * @throws Rethrows exceptions that happened while reading or unpacking the
+   *         Frames of this batch
+   */
+  std::vector<podio::Frame> nextBatch() {
+    std::unique_lock lock{m_mutex};
+    m_readyCond.wait(lock, [this]() { return m_ready.count(m_nextYield) || isExhausted(); });
+    if (isExhausted()) {
+      return {};
+    }
+
+    auto node = m_ready.extract(m_nextYield++);
+    lock.unlock();
+    m_spaceCond.notify_all();
+
+    if (node.mapped().error) {
+      std::rethrow_exception(node.mapped().error);
+    }
+    return std::move(node.mapped().frames);
+  }
+
+private:
+  struct Batch {
+    std::vector<podio::Frame> frames{};
+    std::exception_ptr error{nullptr};
+  };
+
+  /// Whether all batches have been handed out. Needs m_mutex to be locked
+  bool isExhausted() const {
+    return m_nBatches && m_nextYield >= *m_nBatches;
+  }
+
+  void work() {
+    while (true) {
+      Batch batch;
+      size_t index{0};
+      using FrameDataPtr = decltype(m_reader.readNextEntry(m_category));
+      std::vector<FrameDataPtr> frameData;
+
+      {
+        // Reading happens in the order of the batch indices
+        std::lock_guard readLock{m_readMutex};
+        {
+          std::unique_lock lock{m_mutex};
+          m_spaceCond.wait(lock, [this]() { return m_stop || m_nBatches || m_nextRead < m_nextYield + m_prefetch; });
+          if (m_stop || m_nBatches) {
+            return;
+          }
+          index = m_nextRead++;
+        }
+
+        try {
+          while (frameData.size() < m_batchSize) {
+            auto data = m_reader.readNextEntry(m_category);
+            if (!data) {
+              break;
+            }
+            frameData.emplace_back(std::move(data));
+          }
+        } catch (...) {
+          batch.error = std::current_exception();
+        }
+
+        if (frameData.size() < m_batchSize || batch.error) {
+          std::lock_guard lock{m_mutex};
+          m_nBatches = (frameData.empty() && !batch.error) ? index : index + 1;
+        }
+      }
+
+      if (!batch.error) {
+        try {
+          batch.frames.reserve(frameData.size());
+          for (auto& data : frameData) {
+            const auto& frame = batch.frames.emplace_back(std::move(data));
+            for (const auto& name : frame.getAvailableCollections()) {
+              frame.get(name);
+            }
+          }
+        } catch (...) {
+          batch.error = std::current_exception();
+        }
+      }
+
+      {
+        std::lock_guard lock{m_mutex};
+        if (!frameData.empty() || batch.error) {
+          m_ready.emplace(index, std::move(batch));
+        }
+      }
+      m_readyCond.notify_all();
+    }
+  }
+
+  ReaderT& m_reader;
+  std::string m_category;
+  size_t m_batchSize;
+  size_t m_prefetch;
+
+  std::mutex m_readMutex{}; ///< Serializes the access to the reader
+  std::mutex m_mutex{};     ///< Guards all members below
+  std::condition_variable m_spaceCond{};
+  std::condition_variable m_readyCond{};
+  std::map<size_t, Batch> m_ready{};  ///< Batches that are ready by their index
+  size_t m_nextRead{0};               ///< Index of the next batch to read
+  size_t m_nextYield{0};              ///< Index of the next batch to hand out
+  std::optional<size_t> m_nBatches{}; ///< The number of batches, once known
+  bool m_stop{false};
+
+  std::vector<std::thread> m_threads{}; ///< Last, so that everything is set up when the threads start
+};
+
+} // namespace podio
+
+#endif // PODIO_FRAMEPREFETCHER_H
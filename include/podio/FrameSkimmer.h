@@ -0,0 +1,192 @@
+#ifndef PODIO_FRAMESKIMMER_H
+#define PODIO_FRAMESKIMMER_H
+
+#include "podio/CollectionBase.h"
+#include "podio/CollectionIDTable.h"
+#include "podio/Frame.h"
+#include "podio/GenericParameters.h"
+#include "podio/ObjectID.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Get the passed collections together with all collections that they point
+ * to via their relations (recursively) in the given Frame.
+ *
+ * The relations are determined from the ObjectIDs in the I/O buffers of the
+ * collections, i.e. without unpacking any collection.
+ *
+ * @param frame       The Frame containing the collections
+ * @param collections The names of the collections
+ *
+ * @returns The passed collections followed by the collections they are
+ *          related to. Collections that are referenced but not available in
+ *          the Frame are omitted
+ *
+ * @throws std::invalid_argument if any of the passed collections is not
+ *         available
+ */
+inline std::vector<std::string> getRelatedCollections(const podio::Frame& frame, std::vector<std::string> collections) {
+  const auto idTable = frame.getCollectionIDTableForWrite();
+  // The collections grow while looping over them until no new related
+  // collections are found
+  for (size_t i = 0; i < collections.size(); ++i) {
+    const auto* coll = frame.getCollectionForWrite(collections[i]);
+    if (!coll) {
+      throw std::invalid_argument("Collection '" + collections[i] + "' is not available");
+    }
+
+    // getBuffers is only non-const because the writers need to set up the
+    // branch addresses. The buffers are only read here
+    const auto buffers = const_cast<podio::CollectionBase*>(coll)->getBuffers();
+    auto collIDs = std::set<uint32_t>{};
+    for (const auto& refs : *buffers.references) {
+      for (const auto& id : *refs) {
+        if (id.index != podio::ObjectID::untracked) {
+          collIDs.insert(id.collectionID);
+        }
+      }
+    }
+
+    for (const auto collID : collIDs) {
+      const auto name = idTable.name(collID);
+      if (name && frame.getCollectionForWrite(name.value()) &&
+          std::find(collections.begin(), collections.end(), name.value()) == collections.end()) {
+        collections.emplace_back(name.value());
+      }
+    }
+  }
+
+  return collections;
+}
+
+namespace detail {
+  /// Write the selected collections of a Frame and keep track of which
+  /// collections are written
+  template <typename WriterT>
+  class SkimWriter {
+  public:
+    SkimWriter(WriterT& writer, const std::string& category, const std::vector<std::string>& collections,
+               bool addRelated) :
+        m_writer(writer), m_category(category), m_collections(collections), m_addRelated(addRelated) {
+    }
+
+    void writeFrame(const podio::Frame& frame) {
+      if (m_nFrames == 0) {
+        if (m_collections.empty()) {
+          m_collections = frame.getAvailableCollections();
+        } else if (m_addRelated) {
+          m_collections = getRelatedCollections(frame, m_collections);
+        }
+      } else if (m_addRelated && !m_warned) {
+        // The contents of the first Frame determine the contents of all Frames
+        // that are written, so all we can do here is to warn if other Frames
+        // have relations to collections that are not written
+        const auto related = getRelatedCollections(frame, m_collections);
+        if (related.size() > m_collections.size()) {
+          std::cerr << "PODIO WARNING: Frame " << m_nFrames << " of the skim has relations to collection '"
+                    << related[m_collections.size()]
+                    << "' that is not written, since it is not related in the first skimmed Frame" << std::endl;
+          m_warned = true;
+        }
+      }
+
+      m_writer.writeFrame(frame, m_category, m_collections);
+      ++m_nFrames;
+    }
+
+    size_t getNFrames() const {
+      return m_nFrames;
+    }
+
+  private:
+    WriterT& m_writer;
+    std::string m_category;
+    std::vector<std::string> m_collections;
+    bool m_addRelated;
+    size_t m_nFrames{0};
+    bool m_warned{false};
+  };
+} // namespace detail
+
+/**
+ * Write the selected entries of one category to a writer, only storing the
+ * selected collections.
+ *
+ * The collections are not unpacked for this, i.e. their buffers are written as
+ * they have been read. The collections that are written are determined by the
+ * first selected entry and all further entries have to contain them as well.
+ *
+ * The ReaderT can be any reader offering
+ * std::unique_ptr<FrameDataT> readEntry(const std::string&, unsigned). The
+ * WriterT can be any writer offering writeFrame(const podio::Frame&, const
+ * std::string&, const std::vector<std::string>&).
+ *
+ * @param reader      The reader from which the Frames are read
+ * @param writer      The writer to which the Frames are written. finish() is
+ *                    not called on it
+ * @param category    The category of the Frames
+ * @param entries     The entries to write, in the order in which they should
+ *                    be written
+ * @param collections The collections to write. All collections if empty
+ * @param addRelated  Also write all collections that the selected collections
+ *                    point to via their relations (see getRelatedCollections)
+ *
+ * @returns The number of written Frames
+ *
+ * @throws std::out_of_range if any of the entries is not available
+ */
+template <typename ReaderT, typename WriterT>
+size_t skimFrames(ReaderT& reader, WriterT& writer, const std::string& category,
+                  const std::vector<unsigned>& entries, const std::vector<std::string>& collections = {},
+                  bool addRelated = true) {
+  auto skimWriter = detail::SkimWriter<WriterT>(writer, category, collections, addRelated);
+  for (const auto entry : entries) {
+    auto data = reader.readEntry(category, entry);
+    if (!data) {
+      throw std::out_of_range("Entry " + std::to_string(entry) + " of category '" + category +
+                              "' is not available");
+    }
+    skimWriter.writeFrame(podio::Frame(std::move(data)));
+  }
+
+  return skimWriter.getNFrames();
+}
+
+/**
+ * Write the entries of one category for which the selector returns true to a
+ * writer, only storing the selected collections.
+ *
+ * Only the parameters of the Frames are unpacked to evaluate the selector. See
+ * the overload taking a list of entries for the details.
+ *
+ * @param selector    The selection, taking the entry number and the
+ *                    parameters of the Frame
+ */
+template <typename ReaderT, typename WriterT>
+size_t skimFrames(ReaderT& reader, WriterT& writer, const std::string& category,
+                  const std::function<bool(unsigned, const podio::GenericParameters&)>& selector,
+                  const std::vector<std::string>& collections = {}, bool addRelated = true) {
+  auto skimWriter = detail::SkimWriter<WriterT>(writer, category, collections, addRelated);
+  unsigned entry = 0;
+  while (auto data = reader.readNextEntry(category)) {
+    auto frame = podio::Frame(std::move(data));
+    if (selector(entry++, frame.getParameters())) {
+      skimWriter.writeFrame(frame);
+    }
+  }
+
+  return skimWriter.getNFrames();
+}
+
+} // namespace podio
+
+#endif // PODIO_FRAMESKIMMER_H
@@ -0,0 +1,191 @@
+#ifndef PODIO_FRAMESUMMARY_H
+#define PODIO_FRAMESUMMARY_H
+
+#include "podio/CollectionBuffers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace podio {
+
+/// The information about one collection stored in a Frame
+struct CollectionSummary {
+  std::string name{};   ///< The name of the collection
+  std::string type{};   ///< The collection type
+  uint32_t id{0};       ///< The collection ID
+  bool isSubset{false}; ///< Whether this is a subset collection
+  size_t size{0};       ///< The number of elements
+};
+
+/**
+ * Get the information about all collections stored in some FrameData, without
+ * creating the collections. This consumes the buffers of the FrameData, i.e.
+ * it cannot be used to construct a Frame afterwards. The sizes are taken from
+ * the buffers, hence the FrameData have to be read (and decompressed)
+ * completely before, including all relations and vector members.
+ *
+ * The FrameDataT can be any FrameData that can be used to construct a Frame
+ */
+template <typename FrameDataT>
+std::vector<CollectionSummary> summarizeFrameData(FrameDataT& frameData) {
+  const auto idTable = frameData.getIDTable();
+  std::vector<CollectionSummary> summaries;
+  for (const auto& name : frameData.getAvailableCollections()) {
+    auto buffers = frameData.getCollectionBuffers(name);
+    if (!buffers) {
+      continue;
+    }
+
+    auto& summary = summaries.emplace_back();
+    summary.name = name;
+    summary.type = std::string(buffers->type);
+    summary.id = idTable.collectionID(name).value_or(0);
+    summary.isSubset = buffers->data == nullptr;
+    if (buffers->size) {
+      summary.size = buffers->size(*buffers);
+    }
+    if (buffers->deleteBuffers) {
+      buffers->deleteBuffers(*buffers);
+    }
+  }
+
+  std::sort(summaries.begin(), summaries.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+  return summaries;
+}
+
+/// Statistics of the size of one collection across several Frames
+struct CollectionSizeStats {
+  std::string name{};                             ///< The name of the collection
+  std::string type{};                             ///< The collection type
+  size_t nFrames{0};                              ///< The number of Frames containing the collection
+  size_t total{0};                                ///< The total number of elements
+  size_t min{std::numeric_limits<size_t>::max()}; ///< The minimal number of elements
+  size_t max{0};                                  ///< The maximal number of elements
+
+  /// The mean number of elements per Frame containing the collection
+  double mean() const {
+    return nFrames ? double(total) / nFrames : 0.;
+  }
+
+  void add(size_t size) {
+    ++nFrames;
+    total += size;
+    min = std::min(min, size);
+    max = std::max(max, size);
+  }
+
+  void merge(const CollectionSizeStats& other) {
+    nFrames += other.nFrames;
+    total += other.total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+};
+
+/**
+ * Compute the size statistics of all collections for a range of entries of a
+ * category in a file, without creating any collections. NOTE: This is not a
+ * cheap metadata scan. None of the backends stores the collection sizes
+ * separately, hence every entry is read and decompressed completely via
+ * readEntry. Only unpacking the collections is skipped.
+ *
+ * The entries are split into contiguous ranges that are processed in parallel,
+ * each thread using its own reader. NOTE: For the ROOT based readers
+ * ROOT::EnableThreadSafety has to be called before using more than one thread.
+ *
+ * @param filename The name of the file
+ * @param category The category of the Frames
+ * @param first    The first entry to process
+ * @param last     One past the last entry to process. Clamped to the number
+ *                 of available entries
+ * @param nThreads The number of threads to use
+ *
+ * @returns The statistics of all collections, sorted by their name
+ *
+ * @throws Rethrows the first exception that happened while reading
+ *
+ * The ReaderT can be any reader offering openFile, getEntries and readEntry.
+ */
+template <typename ReaderT>
+std::vector<CollectionSizeStats> collectionSizeStats(const std::string& filename, const std::string& category,
+                                                     size_t first = 0,
+                                                     size_t last = std::numeric_limits<size_t>::max(),
+                                                     size_t nThreads = 1) {
+  using StatsMap = std::map<std::string, CollectionSizeStats>;
+
+  const auto process = [&filename, &category](size_t begin, size_t end, StatsMap& stats, std::exception_ptr& error) {
+    try {
+      ReaderT reader{};
+      reader.openFile(filename);
+      for (auto entry = begin; entry < end; ++entry) {
+        auto frameData = reader.readEntry(category, static_cast<unsigned>(entry));
+        if (!frameData) {
+          break;
+        }
+        for (const auto& summary : summarizeFrameData(*frameData)) {
+          auto& collStats = stats[summary.name];
+          collStats.name = summary.name;
+          collStats.type = summary.type;
+          collStats.add(summary.size);
+        }
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+  };
+
+  {
+    ReaderT reader{};
+    reader.openFile(filename);
+    last = std::min<size_t>(last, reader.getEntries(category));
+  }
+  first = std::min(first, last);
+  nThreads = std::max<size_t>(1, std::min(nThreads, last - first));
+
+  std::vector<StatsMap> threadStats(nThreads);
+  std::vector<std::exception_ptr> errors(nThreads);
+  std::vector<std::thread> threads;
+  const auto nEntries = last - first;
+  for (size_t i = 0; i < nThreads; ++i) {
+    const auto begin = first + i * nEntries / nThreads;
+    const auto end = first + (i + 1) * nEntries / nThreads;
+    threads.emplace_back(process, begin, end, std::ref(threadStats[i]), std::ref(errors[i]));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  StatsMap allStats;
+  for (const auto& stats : threadStats) {
+    for (const auto& [name, collStats] : stats) {
+      auto [it, inserted] = allStats.emplace(name, collStats);
+      if (!inserted) {
+        it->second.merge(collStats);
+      }
+    }
+  }
+
+  std::vector<CollectionSizeStats> result;
+  result.reserve(allStats.size());
+  for (auto& [_, collStats] : allStats) {
+    result.emplace_back(std::move(collStats));
+  }
+  return result;
+}
+
+} // namespace podio
+
+#endif // PODIO_FRAMESUMMARY_H
@@ -0,0 +1,17 @@
+#ifndef PODIO_IOBUFFERPOLICY_H
+#define PODIO_IOBUFFERPOLICY_H
+
+namespace podio {
+
+/**
+ * What happens to the I/O buffers of a collection that has been read, once its
+ * objects have been created from them (in prepareAfterRead).
+ */
+enum class IOBufferPolicy {
+  Keep,   ///< Keep all buffers, so that the collection can be written again without calling prepareForWrite
+  Release ///< Release the buffers that are duplicated by the objects, to reduce the memory usage of read-only jobs
+};
+
+} // namespace podio
+
+#endif // PODIO_IOBUFFERPOLICY_H
@@ -0,0 +1,136 @@
+#ifndef PODIO_IOSTATS_H
+#define PODIO_IOSTATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace podio {
+
+/**
+ * I/O statistics of one collection (or of the data of a Frame that cannot be
+ * attributed to a single collection) accumulated over all Frames of a category.
+ *
+ * When reading, the times refer to decompression, deserialization,
+ * prepareAfterRead and setReferences, when writing to compression,
+ * serialization and prepareForWrite. Not all backends can determine all of
+ * these separately, see the documentation of the readers and writers.
+ */
+struct CollectionIOStats {
+  using Duration = std::chrono::nanoseconds;
+
+  uint64_t nEntries{0};          ///< The number of times this has been read or written
+  uint64_t compressedBytes{0};   ///< The number of (compressed) bytes on file
+  uint64_t uncompressedBytes{0}; ///< The number of uncompressed bytes
+  Duration compressionTime{0};   ///< The time spent (de)compressing
+  Duration serializationTime{0}; ///< The time spent (de)serializing
+  Duration prepareTime{0};       ///< The time spent in prepareAfterRead or prepareForWrite
+  Duration setReferencesTime{0}; ///< The time spent in setReferences (only when reading)
+
+  CollectionIOStats& operator+=(const CollectionIOStats& other);
+};
+
+/// The I/O statistics of one category
+struct CategoryIOStats {
+  /// The data that cannot be attributed to one collection, e.g. the
+  /// parameters. The number of entries is the number of Frames
+  CollectionIOStats frame{};
+  std::map<std::string, CollectionIOStats> collections{}; ///< The statistics for each collection
+
+  /// Get the sum of the statistics of the Frames and all collections
+  CollectionIOStats total() const;
+};
+
+/**
+ * Thread-safe accumulator for the I/O statistics of a reader or writer.
+ *
+ * Readers and writers own this via a shared_ptr, since Frames that have been
+ * read keep recording how long it takes to unpack their collections even after
+ * the reader has been destroyed.
+ */
+class IOStats {
+public:
+  IOStats() = default;
+  IOStats(const IOStats&) = delete;
+  IOStats& operator=(const IOStats&) = delete;
+  IOStats(IOStats&&) = delete;
+  IOStats& operator=(IOStats&&) = delete;
+  ~IOStats() = default;
+
+  /// Add the statistics of the Frame level data of the given category and
+  /// those of its collections
+  void addFrame(const std::string& category, const CollectionIOStats& frameStats,
+                const std::vector<std::pair<std::string, CollectionIOStats>>& collStats = {});
+
+  /// Add the statistics for one collection of the given category
+  void add(const std::string& category, const std::string& collection, const CollectionIOStats& stats);
+
+  /// Get (a copy of) the statistics of all categories
+  std::map<std::string, CategoryIOStats> get() const;
+
+  /// Get (a copy of) the statistics of one category. Empty statistics if
+  /// nothing has been recorded for this category
+  CategoryIOStats get(const std::string& category) const;
+
+  /// Discard everything that has been recorded so far
+  void reset();
+
+  /// Print a summary table of all statistics to the passed stream
+  void print(std::ostream& os = std::cout) const;
+
+private:
+  mutable std::mutex m_mutex{};
+  std::map<std::string, CategoryIOStats> m_stats{};
+};
+
+/**
+ * The handle through which the FrameData of the readers (and the Frame) record
+ * the statistics of one category. Default constructed it is disabled and
+ * records nothing.
+ */
+class IOStatsRecorder {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  IOStatsRecorder() = default;
+  IOStatsRecorder(std::shared_ptr<IOStats> stats, std::string category) :
+      m_stats(std::move(stats)), m_category(std::move(category)) {
+  }
+
+  /// Whether statistics should be recorded
+  explicit operator bool() const {
+    return m_stats != nullptr;
+  }
+
+  void addFrame(const CollectionIOStats& frameStats,
+                const std::vector<std::pair<std::string, CollectionIOStats>>& collStats = {}) const {
+    if (m_stats) {
+      m_stats->addFrame(m_category, frameStats, collStats);
+    }
+  }
+
+  void add(const std::string& collection, const CollectionIOStats& stats) const {
+    if (m_stats) {
+      m_stats->add(m_category, collection, stats);
+    }
+  }
+
+  /// Get the time that has passed since start
+  static CollectionIOStats::Duration elapsedSince(Clock::time_point start) {
+    return std::chrono::duration_cast<CollectionIOStats::Duration>(Clock::now() - start);
+  }
+
+private:
+  std::shared_ptr<IOStats> m_stats{nullptr};
+  std::string m_category{};
+};
+
+} // namespace podio
+
+#endif // PODIO_IOSTATS_H
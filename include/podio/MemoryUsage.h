@@ -0,0 +1,58 @@
+#ifndef PODIO_MEMORYUSAGE_H
+#define PODIO_MEMORYUSAGE_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace podio {
+
+/**
+ * The (approximate) heap memory in bytes that is used by a collection (or a
+ * Frame), split by what it is used for.
+ *
+ * Only the memory that is owned by podio is accounted for, e.g. heap memory of
+ * strings inside the data of objects is not included. Handles to the objects
+ * that are held by users are also not accounted for.
+ */
+struct MemoryUsage {
+  std::size_t payload{0};   ///< The objects (including their vector members)
+  std::size_t relations{0}; ///< The book-keeping of relations between objects
+  std::size_t ioBuffers{0}; ///< The I/O buffers that are kept alive by the collection
+
+  /// The total memory
+  std::size_t total() const {
+    return payload + relations + ioBuffers;
+  }
+
+  MemoryUsage& operator+=(const MemoryUsage& other) {
+    payload += other.payload;
+    relations += other.relations;
+    ioBuffers += other.ioBuffers;
+    return *this;
+  }
+};
+
+inline MemoryUsage operator+(MemoryUsage lhs, const MemoryUsage& rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+namespace utils {
+  /// Get the heap memory that is reserved by a vector
+  template <typename T>
+  std::size_t memoryOf(const std::vector<T>& vec) {
+    return vec.capacity() * sizeof(T);
+  }
+
+  /// Get the heap memory that is reserved by a heap allocated vector
+  /// (including the vector itself)
+  template <typename T, typename DeleterT>
+  std::size_t memoryOf(const std::unique_ptr<std::vector<T>, DeleterT>& vec) {
+    return vec ? sizeof(std::vector<T>) + memoryOf(*vec) : 0;
+  }
+} // namespace utils
+
+} // namespace podio
+
+#endif // PODIO_MEMORYUSAGE_H
@@ -3,11 +3,14 @@
 
 #include "podio/CollectionBranches.h"
 #include "podio/ICollectionProvider.h"
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
 #include "podio/ROOTFrameData.h"
 #include "podio/SchemaEvolution.h"
 #include "podio/podioVersion.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -71,6 +74,35 @@ public:
 
   void closeFile();
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are read
+   * from now on (see podio::IOStats). Enabling them discards all statistics
+   * that have been recorded before.
+   *
+   * RNTuple reads (and decompresses) all fields of an entry in one go, hence
+   * only the time for reading the whole Frame is recorded as serialization
+   * time and no bytes are recorded.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
+  /**
+   * Set what happens to the I/O buffers of collections of all Frames that are
+   * read from now on, once the collections have been unpacked. By default they
+   * are kept, such that the collections can be written again without having
+   * to prepare them for writing. Releasing them reduces the memory usage of
+   * jobs that only read collections.
+   */
+  void setIOBufferPolicy(podio::IOBufferPolicy policy) {
+    m_bufferPolicy = policy;
+  }
+
 private:
   /**
    * Initialize the given category by filling the maps with metadata information
@@ -111,6 +143,9 @@ private:
   std::vector<std::string> m_availableCategories{};
 
   std::unordered_map<std::string, std::shared_ptr<podio::CollectionIDTable>> m_idTables{};
+
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
+  podio::IOBufferPolicy m_bufferPolicy{podio::IOBufferPolicy::Keep}; ///< What happens to unpacked I/O buffers
 };
 
 } // namespace podio
@@ -4,13 +4,16 @@
 #include "podio/CollectionBase.h"
 #include "podio/Frame.h"
 #include "podio/GenericParameters.h"
+#include "podio/IOStats.h"
 #include "podio/SchemaEvolution.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
 #include "TFile.h"
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -19,7 +22,14 @@ namespace podio {
 
 class RNTupleWriter {
 public:
-  RNTupleWriter(const std::string& filename);
+  /** Create a writer for the given file.
+   *
+   * @param filename            The output file. Will be overwritten if it exists
+   * @param compressionSettings The ROOT compression settings (algorithm * 100 +
+   *                            level) of all written RNTuples
+   */
+  RNTupleWriter(const std::string& filename,
+                int compressionSettings = ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose);
   ~RNTupleWriter();
 
   RNTupleWriter(const RNTupleWriter&) = delete;
@@ -48,6 +58,24 @@ public:
   std::tuple<std::vector<std::string>, std::vector<std::string>>
   checkConsistency(const std::vector<std::string>& collsToWrite, const std::string& category) const;
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are
+   * written from now on (see podio::IOStats). Enabling them discards all
+   * statistics that have been recorded before.
+   *
+   * RNTuple serializes and compresses all fields of an entry in one go (and
+   * possibly asynchronously), hence only the time of filling the whole Frame
+   * is recorded as serialization time and no bytes are recorded.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
 private:
   using StoreCollection = std::pair<const std::string&, podio::CollectionBase*>;
   std::unique_ptr<ROOT::Experimental::RNTupleModel> createModels(const std::vector<StoreCollection>& collections);
@@ -56,6 +84,7 @@ private:
   std::unique_ptr<ROOT::Experimental::RNTupleWriter> m_metadataWriter{};
 
   std::unique_ptr<TFile> m_file{};
+  ROOT::Experimental::RNTupleWriteOptions m_writeOptions{}; ///< The options (e.g. compression) of all RNTuples
 
   DatamodelDefinitionCollector m_datamodelCollector{};
 
@@ -73,6 +102,8 @@ private:
 
   bool m_finished{false};
 
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
+
   std::vector<std::string> m_intkeys{}, m_floatkeys{}, m_doublekeys{}, m_stringkeys{};
 
   std::vector<std::vector<int>> m_intvalues{};
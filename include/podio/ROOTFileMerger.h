@@ -0,0 +1,39 @@
+#ifndef PODIO_ROOTFILEMERGER_H
+#define PODIO_ROOTFILEMERGER_H
+
+#include <string>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Merge several files written by the ROOTWriter into one output file.
+ *
+ * If the contents of all categories (i.e. the collection ID tables and the
+ * collection types and schema versions) and the podio versions of all input
+ * files are the same, the TTrees of all categories are concatenated by fast
+ * cloning their baskets, i.e. without decompressing and deserializing them.
+ * The podio_metadata of the output file holds the (common) collection ID
+ * tables and collection infos as well as the merged EDM definitions of all
+ * inputs.
+ *
+ * Otherwise (or if fast cloning is disabled) all Frames are read and written
+ * again, which requires the dictionaries of all datamodels in the input files
+ * to be available.
+ *
+ * @param inputFiles The input files. The entries of the output file are in the
+ *                   order of these files
+ * @param outputFile The output file. Will be overwritten if it exists
+ * @param fastClone  Whether to fast clone the TTrees if possible
+ *
+ * @returns true if the TTrees have been fast cloned, false if all Frames have
+ *          been read and written again
+ *
+ * @throws std::runtime_error if any of the input files cannot be opened or is
+ *         not a podio file
+ */
+bool mergeROOTFiles(const std::vector<std::string>& inputFiles, const std::string& outputFile, bool fastClone = true);
+
+} // namespace podio
+
+#endif // PODIO_ROOTFILEMERGER_H
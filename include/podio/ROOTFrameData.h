@@ -4,6 +4,8 @@
 #include "podio/CollectionBuffers.h"
 #include "podio/CollectionIDTable.h"
 #include "podio/GenericParameters.h"
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
 
 #include <memory>
 #include <optional>
@@ -25,8 +27,13 @@ public:
   ROOTFrameData(const ROOTFrameData&) = delete;
   ROOTFrameData& operator=(const ROOTFrameData&) = delete;
 
-  ROOTFrameData(BufferMap&& buffers, CollIDPtr&& idTable, podio::GenericParameters&& params) :
-      m_buffers(std::move(buffers)), m_idTable(std::move(idTable)), m_parameters(std::move(params)) {
+  ROOTFrameData(BufferMap&& buffers, CollIDPtr&& idTable, podio::GenericParameters&& params,
+                podio::IOStatsRecorder ioStats = {}, podio::IOBufferPolicy bufferPolicy = podio::IOBufferPolicy::Keep) :
+      m_buffers(std::move(buffers)),
+      m_idTable(std::move(idTable)),
+      m_parameters(std::move(params)),
+      m_ioStats(std::move(ioStats)),
+      m_bufferPolicy(bufferPolicy) {
   }
 
   std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name) {
@@ -57,6 +64,18 @@ public:
     return collections;
   }
 
+  /// Get the recorder for the I/O statistics of the reader (disabled if the
+  /// reader does not record any)
+  const podio::IOStatsRecorder& getIOStats() const {
+    return m_ioStats;
+  }
+
+  /// Get what should happen to the I/O buffers of collections once they have
+  /// been unpacked
+  podio::IOBufferPolicy getIOBufferPolicy() const {
+    return m_bufferPolicy;
+  }
+
 private:
   // TODO: switch to something more elegant once the basic functionality and
   // interface is better defined
@@ -64,6 +83,8 @@ private:
   // This is co-owned by each FrameData and the original reader. (for now at least)
   CollIDPtr m_idTable{nullptr};
   podio::GenericParameters m_parameters{};
+  podio::IOStatsRecorder m_ioStats{};
+  podio::IOBufferPolicy m_bufferPolicy{podio::IOBufferPolicy::Keep};
 };
 
 // Interim workaround for https://github.com/AIDASoft/podio#500
@@ -2,6 +2,8 @@
 #define PODIO_ROOTREADER_H
 
 #include "podio/CollectionBranches.h"
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
 #include "podio/ROOTFrameData.h"
 #include "podio/podioVersion.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
@@ -108,6 +110,35 @@ public:
     return m_datamodelHolder.getAvailableDatamodels();
   }
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are read
+   * from now on (see podio::IOStats). Enabling them discards all statistics
+   * that have been recorded before.
+   *
+   * ROOT decompresses and deserializes the data of a branch in one go, so the
+   * time for both is recorded as serialization time. The compressed bytes of
+   * each entry are estimated from the overall compression of the branches.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
+  /**
+   * Set what happens to the I/O buffers of collections of all Frames that are
+   * read from now on, once the collections have been unpacked. By default they
+   * are kept, such that the collections can be written again without having
+   * to prepare them for writing. Releasing them reduces the memory usage of
+   * jobs that only read collections.
+   */
+  void setIOBufferPolicy(podio::IOBufferPolicy policy) {
+    m_bufferPolicy = policy;
+  }
+
 private:
   /**
    * Helper struct to group together all the necessary state to read / process a
@@ -145,20 +176,22 @@ private:
   /**
    * Read the parameters for the entry specified in the passed CategoryInfo
    */
-  GenericParameters readEntryParameters(CategoryInfo& catInfo, bool reloadBranches, unsigned int localEntry);
+  GenericParameters readEntryParameters(CategoryInfo& catInfo, bool reloadBranches, unsigned int localEntry,
+                                        podio::CollectionIOStats* stats);
 
   /**
    * Read the data entry specified in the passed CategoryInfo, and increase the
    * counter afterwards. In case the requested entry is larger than the
    * available number of entries, return a nullptr.
    */
-  std::unique_ptr<podio::ROOTFrameData> readEntry(ROOTReader::CategoryInfo& catInfo);
+  std::unique_ptr<podio::ROOTFrameData> readEntry(ROOTReader::CategoryInfo& catInfo, const std::string& category);
 
   /**
-   * Get / read the buffers at index iColl in the passed category information
+   * Get / read the buffers at index iColl in the passed category information.
+   * Record the I/O statistics if stats is not a nullptr
    */
   podio::CollectionReadBuffers getCollectionBuffers(CategoryInfo& catInfo, size_t iColl, bool reloadBranches,
-                                                    unsigned int localEntry);
+                                                    unsigned int localEntry, podio::CollectionIOStats* stats);
 
   std::unique_ptr<TChain> m_metaChain{nullptr};                 ///< The metadata tree
   std::unordered_map<std::string, CategoryInfo> m_categories{}; ///< All categories
@@ -166,6 +199,9 @@ private:
 
   podio::version::Version m_fileVersion{0, 0, 0};
   DatamodelDefinitionHolder m_datamodelHolder{};
+
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
+  podio::IOBufferPolicy m_bufferPolicy{podio::IOBufferPolicy::Keep}; ///< What happens to unpacked I/O buffers
 };
 
 } // namespace podio
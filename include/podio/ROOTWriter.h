@@ -3,6 +3,7 @@
 
 #include "podio/CollectionBranches.h"
 #include "podio/CollectionIDTable.h"
+#include "podio/IOStats.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
 #include "TFile.h"
@@ -23,7 +24,14 @@ class GenericParameters;
 
 class ROOTWriter {
 public:
-  ROOTWriter(const std::string& filename);
+  /** Create a writer for the given file.
+   *
+   * @param filename            The output file. Will be overwritten if it exists
+   * @param compressionSettings The ROOT compression settings (algorithm * 100 +
+   *                            level) of the output file
+   */
+  ROOTWriter(const std::string& filename,
+             int compressionSettings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
   ~ROOTWriter();
 
   ROOTWriter(const ROOTWriter&) = delete;
@@ -65,6 +73,24 @@ public:
   std::tuple<std::vector<std::string>, std::vector<std::string>>
   checkConsistency(const std::vector<std::string>& collsToWrite, const std::string& category) const;
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are
+   * written from now on (see podio::IOStats). Enabling them discards all
+   * statistics that have been recorded before.
+   *
+   * ROOT serializes and compresses the data of all branches when filling the
+   * TTree, so the time for both is recorded as serialization time of the
+   * Frame. The (compressed) bytes of the collections are recorded in finish.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
 private:
   using StoreCollection = std::pair<const std::string&, podio::CollectionBase*>;
 
@@ -91,6 +117,9 @@ private:
   /// Get the (potentially uninitialized category information for this category)
   CategoryInfo& getCategoryInfo(const std::string& category);
 
+  /// Record the (compressed) bytes of all branches in the I/O statistics
+  void recordBytes();
+
   static void resetBranches(std::vector<root_utils::CollectionBranches>& branches,
                             const std::vector<ROOTWriter::StoreCollection>& collections,
                             /*const*/ podio::GenericParameters* parameters);
@@ -101,6 +130,8 @@ private:
   DatamodelDefinitionCollector m_datamodelCollector{};
 
   bool m_finished{false}; ///< Whether writing has been actually done
+
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
 };
 
 } // namespace podio
@@ -1,23 +1,150 @@
 #ifndef PODIO_RELATIONRANGE_H
 #define PODIO_RELATIONRANGE_H
 
+#include "podio/utilities/PackedRelation.h"
+
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace podio {
 /**
  * A simple helper class that allows to return related objects in a way that
  * makes it possible to use the return type in a range-based for loop.
+ *
+ * The related objects are either stored contiguously (e.g. for newly created
+ * objects), or they are part of a utils::PackedRelation (for objects that have
+ * been read), in which case they are only materialized on access. In both cases
+ * size() and indexed access are O(1).
  */
 template <typename ReferenceType>
 class RelationRange {
+  using PackedRelationT = utils::PackedRelation<ReferenceType>;
+
 public:
-  using ConstIteratorType = typename std::vector<ReferenceType>::const_iterator;
+  /// Iterator over the related objects. Dereferencing returns the related
+  /// object by value, hence it is only an input iterator for the standard
+  /// library (before c++20), even though it offers all the operations of a
+  /// random access iterator, which c++20 can make use of
+  class const_iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = ReferenceType;
+    using difference_type = std::ptrdiff_t;
+    using reference = ReferenceType;
+
+    /// Helper for making operator-> work with the by-value dereferencing
+    class pointer {
+    public:
+      explicit pointer(ReferenceType ref) : m_ref(std::move(ref)) {
+      }
+      const ReferenceType* operator->() const {
+        return &m_ref;
+      }
+
+    private:
+      ReferenceType m_ref;
+    };
+
+    const_iterator() = default;
+    const_iterator(const ReferenceType* objects, const PackedRelationT* packed, difference_type index) :
+        m_objects(objects), m_packed(packed), m_index(index) {
+    }
+
+    reference operator*() const {
+      return (*this)[0];
+    }
+    pointer operator->() const {
+      return pointer(**this);
+    }
+    reference operator[](difference_type n) const {
+      if (m_packed) {
+        return m_packed->get(m_index + n);
+      }
+      return m_objects[m_index + n];
+    }
+
+    const_iterator& operator++() {
+      ++m_index;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      auto tmp = *this;
+      ++m_index;
+      return tmp;
+    }
+    const_iterator& operator--() {
+      --m_index;
+      return *this;
+    }
+    const_iterator operator--(int) {
+      auto tmp = *this;
+      --m_index;
+      return tmp;
+    }
+    const_iterator& operator+=(difference_type n) {
+      m_index += n;
+      return *this;
+    }
+    const_iterator& operator-=(difference_type n) {
+      m_index -= n;
+      return *this;
+    }
+    friend const_iterator operator+(const_iterator it, difference_type n) {
+      return it += n;
+    }
+    friend const_iterator operator+(difference_type n, const_iterator it) {
+      return it += n;
+    }
+    friend const_iterator operator-(const_iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index - rhs.m_index;
+    }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index == rhs.m_index;
+    }
+    friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index != rhs.m_index;
+    }
+    friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index < rhs.m_index;
+    }
+    friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index > rhs.m_index;
+    }
+    friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index <= rhs.m_index;
+    }
+    friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.m_index >= rhs.m_index;
+    }
+
+  private:
+    const ReferenceType* m_objects{nullptr};  ///< The contiguously stored objects (if not packed)
+    const PackedRelationT* m_packed{nullptr}; ///< The packed relation (if packed)
+    difference_type m_index{0};               ///< The current position
+  };
+
+  using ConstIteratorType = const_iterator;
 
   RelationRange() = delete;
 
-  RelationRange(ConstIteratorType begin, ConstIteratorType end) :
-      m_begin(begin), m_end(end), m_size(std::distance(m_begin, m_end)) {
+  /// Constructor from a range of contiguously stored objects
+  RelationRange(const ReferenceType* begin, const ReferenceType* end) :
+      m_begin(begin, nullptr, 0), m_end(begin, nullptr, end - begin) {
+  }
+
+  /// Constructor from the [begin, end) range of a packed relation
+  RelationRange(const PackedRelationT* packed, size_t begin, size_t end) :
+      m_begin(nullptr, packed, begin), m_end(nullptr, packed, end) {
   }
 
   /// begin of the range (necessary for range-based for loop)
@@ -30,7 +157,7 @@ public:
   }
   /// convenience overload for size
   size_t size() const {
-    return m_size;
+    return m_end - m_begin;
   }
   /// convenience overload to check if the range is empty
   bool empty() const {
@@ -38,24 +165,38 @@ public:
   }
   /// Indexed access
   ReferenceType operator[](size_t i) const {
-    auto it = m_begin;
-    std::advance(it, i);
-    return *it;
+    return m_begin[i];
   }
   /// Indexed access with range check
   ReferenceType at(size_t i) const {
-    if (i < m_size) {
-      auto it = m_begin;
-      std::advance(it, i);
-      return *it;
+    if (i < size()) {
+      return m_begin[i];
     }
     throw std::out_of_range("index out of bounds for RelationRange");
   }
 
+  /// Project all related objects into a contiguous vector, e.g.
+  ///
+  /// @code
+  /// const auto energies = cluster.Hits().project([](const auto& h) { return h.energy(); });
+  /// @endcode
+  ///
+  /// The related objects themselves are not stored contiguously, but the
+  /// returned vector can be handed to anything that works on contiguous data.
+  template <typename ProjectionF>
+  auto project(ProjectionF&& projection) const {
+    using ValueT = std::decay_t<std::invoke_result_t<ProjectionF, const ReferenceType&>>;
+    auto values = std::vector<ValueT>{};
+    values.reserve(size());
+    for (auto it = m_begin; it != m_end; ++it) {
+      values.emplace_back(std::invoke(projection, *it));
+    }
+    return values;
+  }
+
 private:
   ConstIteratorType m_begin;
   ConstIteratorType m_end;
-  size_t m_size{0};
 };
 } // namespace podio
 
@@ -5,6 +5,7 @@
 #include "podio/CollectionBuffers.h"
 #include "podio/SIOBlock.h"
 #include "podio/UserDataCollection.h"
+#include "podio/UserDataTable.h"
 
 #include <sio/api.h>
 #include <sio/io_device.h>
@@ -69,5 +70,53 @@ public:
 private:
 };
 
+/// SIO block for a UserDataTable, storing the column names followed by the
+/// values of all columns
+template <typename BasicType, typename = EnableIfSupportedUserType<BasicType>>
+class SIOBlockUserDataTable : public podio::SIOBlock {
+public:
+  SIOBlockUserDataTable() :
+      SIOBlock("UserDataTable_" + detail::sio_name<BasicType>(),
+               sio::version::encode_version(UserDataTable<BasicType>::schemaVersion, 0)) {
+
+    podio::SIOBlockFactory::instance().registerBlockForCollection(podio::userDataTableTypeName<BasicType>(), this);
+  }
+
+  SIOBlockUserDataTable(const std::string& name) :
+      SIOBlock(name, sio::version::encode_version(UserDataTable<BasicType>::schemaVersion, 0)) {
+  }
+
+  void read(sio::read_device& device, sio::version_type version) override {
+    const auto& bufferFactory = podio::CollectionBufferFactory::instance();
+    m_buffers =
+        bufferFactory
+            .createBuffers(podio::userDataTableTypeName<BasicType>(), sio::version::major_version(version), false)
+            .value();
+
+    auto* names = podio::CollectionReadBuffers::asVector<std::string>((*m_buffers.vectorMembers)[0].second);
+    device.data(*names);
+
+    auto* dataVec = m_buffers.dataAsVector<BasicType>();
+    unsigned size(0);
+    device.data(size);
+    dataVec->resize(size);
+    podio::handlePODDataSIO(device, dataVec->data(), size);
+  }
+
+  void write(sio::write_device& device) override {
+    auto* names = podio::CollectionWriteBuffers::asVector<std::string>((*m_buffers.vectorMembers)[0].second);
+    device.data(*names);
+
+    auto* dataVec = podio::CollectionWriteBuffers::asVector<BasicType>(m_buffers.data);
+    unsigned size = dataVec->size();
+    device.data(size);
+    podio::handlePODDataSIO(device, dataVec->data(), size);
+  }
+
+  SIOBlock* create(const std::string& name) const override {
+    return new SIOBlockUserDataTable(name);
+  }
+};
+
 } // namespace podio
 #endif
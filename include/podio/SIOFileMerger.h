@@ -0,0 +1,28 @@
+#ifndef PODIO_SIOFILEMERGER_H
+#define PODIO_SIOFILEMERGER_H
+
+#include <string>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Merge several files written by the SIOWriter into one output file.
+ *
+ * The (compressed) records of all Frames are copied as they are, i.e. without
+ * decompressing and deserializing them, and a new table of contents is built
+ * for the output file. The EDM definitions of all inputs are merged.
+ *
+ * @param inputFiles The input files. The entries of the output file are in the
+ *                   order of these files
+ * @param outputFile The output file. Will be overwritten if it exists
+ *
+ * @throws std::runtime_error if any of the input files cannot be opened, has
+ *         no table of contents, or has been written by a different podio
+ *         version than the others
+ */
+void mergeSIOFiles(const std::vector<std::string>& inputFiles, const std::string& outputFile);
+
+} // namespace podio
+
+#endif // PODIO_SIOFILEMERGER_H
@@ -4,6 +4,8 @@
 #include "podio/CollectionBuffers.h"
 #include "podio/CollectionIDTable.h"
 #include "podio/GenericParameters.h"
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
 #include "podio/SIOBlock.h"
 
 #include <sio/buffer.h>
@@ -37,13 +39,18 @@ public:
    * Constructor from the collBuffers containing the collection data and a
    * tableBuffer containing the necessary information for unpacking the
    * collections. The two size parameters denote the uncompressed size of the
-   * respective buffers.
+   * respective buffers. The I/O statistics are recorded via ioStats (if
+   * enabled) and the bufferPolicy determines what happens to the I/O buffers
+   * of collections once they have been unpacked.
    */
-  SIOFrameData(sio::buffer&& collBuffers, std::size_t dataSize, sio::buffer&& tableBuffer, std::size_t tableSize) :
+  SIOFrameData(sio::buffer&& collBuffers, std::size_t dataSize, sio::buffer&& tableBuffer, std::size_t tableSize,
+               podio::IOStatsRecorder ioStats = {}, podio::IOBufferPolicy bufferPolicy = podio::IOBufferPolicy::Keep) :
       m_recBuffer(std::move(collBuffers)),
       m_tableBuffer(std::move(tableBuffer)),
       m_dataSize(dataSize),
-      m_tableSize(tableSize) {
+      m_tableSize(tableSize),
+      m_ioStats(std::move(ioStats)),
+      m_bufferPolicy(bufferPolicy) {
   }
 
   std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name);
@@ -59,6 +66,18 @@ public:
 
   std::vector<std::string> getAvailableCollections();
 
+  /// Get the recorder for the I/O statistics of the reader (disabled if the
+  /// reader does not record any)
+  const podio::IOStatsRecorder& getIOStats() const {
+    return m_ioStats;
+  }
+
+  /// Get what should happen to the I/O buffers of collections once they have
+  /// been unpacked
+  podio::IOBufferPolicy getIOBufferPolicy() const {
+    return m_bufferPolicy;
+  }
+
 private:
   void unpackBuffers();
 
@@ -83,6 +102,9 @@ private:
   std::vector<short> m_subsetCollectionBits{};
 
   podio::GenericParameters m_parameters{};
+
+  podio::IOStatsRecorder m_ioStats{};
+  podio::IOBufferPolicy m_bufferPolicy{podio::IOBufferPolicy::Keep};
 };
 } // namespace podio
 
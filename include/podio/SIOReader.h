@@ -1,6 +1,8 @@
 #ifndef PODIO_SIOREADER_H
 #define PODIO_SIOREADER_H
 
+#include "podio/IOBufferPolicy.h"
+#include "podio/IOStats.h"
 #include "podio/SIOBlock.h"
 #include "podio/SIOFrameData.h"
 #include "podio/podioVersion.h"
@@ -64,6 +66,36 @@ public:
     return m_datamodelHolder.getAvailableDatamodels();
   }
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are read
+   * from now on (see podio::IOStats). Enabling them discards all statistics
+   * that have been recorded before.
+   *
+   * SIO compresses all collections of a Frame into one record, that is
+   * decompressed and deserialized as a whole once the Frame is constructed.
+   * Hence, the bytes and the times for these steps are only available for the
+   * whole Frame.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
+  /**
+   * Set what happens to the I/O buffers of collections of all Frames that are
+   * read from now on, once the collections have been unpacked. By default they
+   * are kept, such that the collections can be written again without having
+   * to prepare them for writing. Releasing them reduces the memory usage of
+   * jobs that only read collections.
+   */
+  void setIOBufferPolicy(podio::IOBufferPolicy policy) {
+    m_bufferPolicy = policy;
+  }
+
 private:
   void readPodioHeader();
 
@@ -83,6 +115,9 @@ private:
   podio::version::Version m_fileVersion{0};
 
   DatamodelDefinitionHolder m_datamodelHolder{};
+
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
+  podio::IOBufferPolicy m_bufferPolicy{podio::IOBufferPolicy::Keep}; ///< What happens to unpacked I/O buffers
 };
 
 } // namespace podio
@@ -1,11 +1,13 @@
 #ifndef PODIO_SIOWRITER_H
 #define PODIO_SIOWRITER_H
 
+#include "podio/IOStats.h"
 #include "podio/SIOBlock.h"
 #include "podio/utilities/DatamodelRegistryIOHelpers.h"
 
 #include <sio/definitions.h>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,7 +18,12 @@ class Frame;
 
 class SIOWriter {
 public:
-  SIOWriter(const std::string& filename);
+  /** Create a writer for the given file.
+   *
+   * @param filename         The output file. Will be overwritten if it exists
+   * @param compressionLevel The zlib compression level (0 - 9) of all records
+   */
+  SIOWriter(const std::string& filename, int compressionLevel = 6);
   ~SIOWriter();
 
   SIOWriter(const SIOWriter&) = delete;
@@ -33,11 +40,32 @@ public:
 
   void finish();
 
+  /**
+   * Enable (or disable) recording I/O statistics for all Frames that are
+   * written from now on (see podio::IOStats). Enabling them discards all
+   * statistics that have been recorded before.
+   *
+   * All collections of a Frame are serialized and compressed into one record,
+   * hence the bytes and the times for these steps are only available for the
+   * whole Frame.
+   */
+  void enableIOStats(bool enable = true) {
+    m_ioStats = enable ? std::make_shared<podio::IOStats>() : nullptr;
+  }
+
+  /// Get the recorded I/O statistics, nullptr if they are not enabled
+  std::shared_ptr<const podio::IOStats> getIOStats() const {
+    return m_ioStats;
+  }
+
 private:
   sio::ofstream m_stream{};       ///< The output file stream
   SIOFileTOCRecord m_tocRecord{}; ///< The "table of contents" of the written file
   DatamodelDefinitionCollector m_datamodelCollector{};
-  bool m_finished{false}; ///< Has finish been called already?
+  int m_compressionLevel{6}; ///< The zlib compression level
+  bool m_finished{false};    ///< Has finish been called already?
+
+  std::shared_ptr<podio::IOStats> m_ioStats{nullptr}; ///< The I/O statistics (if enabled)
 };
 } // namespace podio
 
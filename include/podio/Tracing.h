@@ -0,0 +1,149 @@
+#ifndef PODIO_TRACING_H
+#define PODIO_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace podio {
+
+/**
+ * Collects the spans (i.e. the start and the duration) of the work that podio
+ * does in its hot paths, e.g. unpacking collections or reading and writing
+ * Frames. Tracing is disabled by default and can be enabled at runtime, which
+ * only costs an atomic load per span while disabled. The recorded spans can be
+ * written in the Chrome trace event format, which can be loaded into e.g.
+ * Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+ *
+ * While enabled, every span costs two clock reads, a copy of its detail and
+ * locking a buffer of the recording thread, which is only contended while the
+ * spans are retrieved. Each thread keeps at most capacity() spans (roughly 80
+ * bytes each, plus long details), after which the oldest spans of that thread
+ * are overwritten.
+ */
+class Tracer {
+public:
+  /// A recorded span
+  struct Span {
+    const char* name{nullptr};     ///< The name of the span (has to be a string literal)
+    const char* category{nullptr}; ///< The category of the span (has to be a string literal)
+    std::string detail{};          ///< Additional information, e.g. the collection name
+    uint32_t threadID{0};          ///< The (podio internal) ID of the thread
+    int64_t start{0};              ///< The start since the creation of the Tracer [ns]
+    int64_t duration{0};           ///< The duration [ns]
+  };
+
+  using Clock = std::chrono::steady_clock;
+
+  /// The default maximum number of spans that are kept per thread
+  static constexpr size_t DefaultCapacity = 1 << 18;
+
+  /// Get the (global) Tracer
+  static Tracer& instance();
+
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+  Tracer(Tracer&&) = delete;
+  Tracer& operator=(Tracer&&) = delete;
+  ~Tracer() = default;
+
+  /// Enable (or disable) recording spans
+  void enable(bool enable = true) {
+    m_enabled.store(enable, std::memory_order_relaxed);
+  }
+
+  /// Whether spans are currently recorded
+  bool isEnabled() const {
+    return m_enabled.load(std::memory_order_relaxed);
+  }
+
+  /// Record a span that started at start and ends now
+  void record(const char* name, const char* category, std::string detail, Clock::time_point start);
+
+  /// Get (a copy of) all spans that have been recorded so far. The spans are
+  /// grouped by thread and in the order in which they ended for each thread
+  std::vector<Span> getSpans() const;
+
+  /// Discard all spans that have been recorded so far
+  void clear();
+
+  /// Set the maximum number of spans that are kept per thread. Discards all
+  /// spans that have been recorded so far
+  void setCapacity(size_t capacity);
+
+  /// The maximum number of spans that are kept per thread
+  size_t capacity() const {
+    return m_capacity.load(std::memory_order_relaxed);
+  }
+
+  /// The number of spans that have been overwritten (or not recorded for a
+  /// capacity of 0) since the last clear
+  size_t droppedSpans() const;
+
+  /// Write all recorded spans in the Chrome trace event (JSON) format
+  void writeChromeTrace(std::ostream& os) const;
+
+  /// Write all recorded spans in the Chrome trace event (JSON) format into the
+  /// given file. Throws a std::runtime_error if the file cannot be opened
+  void writeChromeTrace(const std::string& filename) const;
+
+private:
+  /// The spans recorded by one thread
+  struct ThreadBuffer;
+
+  Tracer() = default;
+
+  /// Get the buffer of the calling thread, registering it on first use
+  ThreadBuffer& threadBuffer();
+
+  std::atomic<bool> m_enabled{false};
+  std::atomic<size_t> m_capacity{DefaultCapacity};
+  const Clock::time_point m_epoch{Clock::now()};
+  mutable std::mutex m_mutex{}; ///< Guards the list of buffers, not their contents
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers{};
+};
+
+/**
+ * RAII helper that records a span from its construction to its destruction if
+ * the Tracer is enabled (at construction).
+ */
+class TraceSpan {
+public:
+  /// name and category have to be string literals, the detail is only copied
+  /// if tracing is enabled
+  TraceSpan(const char* name, const char* category, const std::string& detail = "") {
+    if (Tracer::instance().isEnabled()) {
+      m_name = name;
+      m_category = category;
+      m_detail = detail;
+      m_start = Tracer::Clock::now();
+    }
+  }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+  TraceSpan(TraceSpan&&) = delete;
+  TraceSpan& operator=(TraceSpan&&) = delete;
+
+  ~TraceSpan() {
+    if (m_name) {
+      Tracer::instance().record(m_name, m_category, std::move(m_detail), m_start);
+    }
+  }
+
+private:
+  const char* m_name{nullptr};
+  const char* m_category{nullptr};
+  std::string m_detail{};
+  Tracer::Clock::time_point m_start{};
+};
+
+} // namespace podio
+
+#endif // PODIO_TRACING_H
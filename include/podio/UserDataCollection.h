@@ -7,7 +7,12 @@
 #include "podio/SchemaEvolution.h"
 #include "podio/utilities/TypeHelpers.h"
 
+#include <atomic>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <typeindex>
 #include <utility>
@@ -63,14 +68,28 @@ PODIO_ADD_USER_TYPE(uint64_t)
 /** Collection of basic types for additional user data not defined in the EDM.
  *  The data is stored in an std::vector<basic_type>. Supported are all basic types supported in
  *  PODIO, i.e. float, double and 8-64 bit fixed size signed and unsigned integers - @see SupportedUserDataTypes.
+ *  Alternatively, the collection can adopt or borrow externally allocated contiguous memory, which
+ *  is then used without copying it. In this case the data is only copied into a std::vector when
+ *  the collection is prepared for writing, since all I/O backends work on std::vectors.
  *  @author F.Gaede, DESY
  *  @date Sep 2021
  */
 template <typename BasicType, typename = EnableIfSupportedUserType<BasicType>>
 class UserDataCollection : public CollectionBase {
+public:
+  /// The deleter that is called for adopted external memory
+  using DeleterT = std::function<void(BasicType*)>;
 
 private:
   std::vector<BasicType> _vec{};
+  // External memory that is used instead of _vec if present
+  std::unique_ptr<BasicType[], DeleterT> m_extData{nullptr, DeleterT{}};
+  size_t m_extSize{0};
+  // Copy of the external memory for writing, filled in prepareForWrite
+  mutable std::vector<BasicType> m_writeVec{};
+  // Atomic, since the non-const accessors reset it without taking the lock
+  mutable std::atomic<bool> m_isPrepared{false};
+  mutable std::unique_ptr<std::mutex> m_storageMtx{std::make_unique<std::mutex>()};
   // Pointer to the actual storage, necessary for I/O. In order to have
   // simpler move-semantics this will be set and properly initialized on
   // demand during the call to getBuffers
@@ -84,10 +103,51 @@ public:
   /// Constructor from an existing vector (which will be moved from!)
   UserDataCollection(std::vector<BasicType>&& vec) : _vec(std::move(vec)) {
   }
+  /// Constructor adopting external memory of size elements, which will be
+  /// released via the deleter once the collection no longer needs it. Throws
+  /// a std::invalid_argument if the deleter is empty
+  UserDataCollection(BasicType* data, size_t size, DeleterT deleter) :
+      m_extData(data, std::move(deleter)), m_extSize(data ? size : 0) {
+    if (data && !m_extData.get_deleter()) {
+      // Do not leave the memory to the empty deleter
+      m_extData.release();
+      throw std::invalid_argument("A UserDataCollection cannot adopt external memory without a deleter");
+    }
+  }
+  /// Constructor borrowing external memory of size elements, which has to
+  /// outlive the collection
+  UserDataCollection(BasicType* data, size_t size) : UserDataCollection(data, size, [](BasicType*) {}) {
+  }
   UserDataCollection(const UserDataCollection&) = delete;
   UserDataCollection& operator=(const UserDataCollection&) = delete;
-  UserDataCollection(UserDataCollection&&) = default;
-  UserDataCollection& operator=(UserDataCollection&&) = default;
+
+  // std::atomic is not movable, hence the move operations cannot be defaulted
+  UserDataCollection(UserDataCollection&& other) noexcept :
+      _vec(std::move(other._vec)),
+      m_extData(std::move(other.m_extData)),
+      m_extSize(std::exchange(other.m_extSize, 0)),
+      m_writeVec(std::move(other.m_writeVec)),
+      m_isPrepared(other.m_isPrepared.load()),
+      m_storageMtx(std::move(other.m_storageMtx)),
+      m_collectionID(other.m_collectionID),
+      m_refCollections(std::move(other.m_refCollections)),
+      m_vecmem_info(std::move(other.m_vecmem_info)) {
+  }
+
+  UserDataCollection& operator=(UserDataCollection&& other) noexcept {
+    _vec = std::move(other._vec);
+    m_extData = std::move(other.m_extData);
+    m_extSize = std::exchange(other.m_extSize, 0);
+    m_writeVec = std::move(other.m_writeVec);
+    m_isPrepared = other.m_isPrepared.load();
+    m_storageMtx = std::move(other.m_storageMtx);
+    _vecPtr = nullptr;
+    m_collectionID = other.m_collectionID;
+    m_refCollections = std::move(other.m_refCollections);
+    m_vecmem_info = std::move(other.m_vecmem_info);
+    return *this;
+  }
+
   ~UserDataCollection() = default;
 
   /// The schema version of UserDataCollections
@@ -97,8 +157,18 @@ public:
   constexpr static auto valueTypeName = userDataTypeName<BasicType>();
   constexpr static auto dataTypeName = userDataTypeName<BasicType>();
 
-  /// prepare buffers for serialization
+  /// prepare buffers for serialization. Copies external memory (only). Note
+  /// that external memory is only copied again if it has been changed via
+  /// the non-const accessors of this collection in the meantime
   void prepareForWrite() const override {
+    if (!isExternal()) {
+      return;
+    }
+    std::lock_guard lock{*m_storageMtx};
+    if (!m_isPrepared) {
+      m_writeVec.assign(m_extData.get(), m_extData.get() + m_extSize);
+      m_isPrepared = true;
+    }
   }
 
   /// re-create collection from buffers after read
@@ -122,7 +192,12 @@ public:
 
   /// Get the collection buffers for this collection
   podio::CollectionWriteBuffers getBuffers() override {
-    _vecPtr = &_vec; // Set the pointer to the correct internal vector
+    if (isExternal()) {
+      prepareForWrite();
+      _vecPtr = &m_writeVec;
+    } else {
+      _vecPtr = &_vec; // Set the pointer to the correct internal vector
+    }
     return {&_vecPtr, _vecPtr, &m_refCollections, &m_vecmem_info};
   }
 
@@ -133,12 +208,12 @@ public:
 
   /// number of elements in the collection
   size_t size() const override {
-    return _vec.size();
+    return isExternal() ? m_extSize : _vec.size();
   }
 
   /// Is the collection empty
   bool empty() const override {
-    return _vec.empty();
+    return size() == 0;
   }
 
   /// fully qualified type name
@@ -159,6 +234,10 @@ public:
   /// clear the collection and all internal states
   void clear() override {
     _vec.clear();
+    m_extData.reset();
+    m_extSize = 0;
+    m_writeVec.clear();
+    m_isPrepared = false;
   };
 
   /// check if this collection is a subset collection - no subset possible
@@ -178,10 +257,11 @@ public:
   /// Print this collection to the passed stream
   void print(std::ostream& os = std::cout, bool flush = true) const override {
     os << "[";
-    if (!_vec.empty()) {
-      os << _vec[0];
-      for (size_t i = 1; i < _vec.size(); ++i) {
-        os << ", " << _vec[i];
+    if (!empty()) {
+      const auto* values = data();
+      os << values[0];
+      for (size_t i = 1; i < size(); ++i) {
+        os << ", " << values[i];
       }
     }
     os << "]";
@@ -191,48 +271,97 @@ public:
     }
   }
 
+  /// Nothing to release, since the data is used directly from the I/O buffers
+  void releaseIOBuffers() override {
+  }
+
   size_t getDatamodelRegistryIndex() const override {
     return DatamodelRegistry::NoDefinitionNecessary;
   }
 
+  /// Get the (approximate) heap memory that is used by this collection.
+  /// External memory is accounted for as payload, even if it is only borrowed
+  podio::MemoryUsage memoryUsage() const override {
+    auto usage = podio::MemoryUsage{};
+    usage.payload = utils::memoryOf(_vec) + m_extSize * sizeof(BasicType);
+    usage.ioBuffers = utils::memoryOf(m_writeVec);
+    return usage;
+  }
+
+  /// Whether the collection uses external memory instead of an internal std::vector
+  bool isExternal() const {
+    return m_extData != nullptr;
+  }
+
   // ----- some wrappers for std::vector and access to the complete std::vector (if really needed)
 
-  typename std::vector<BasicType>::iterator begin() {
-    return _vec.begin();
+  BasicType* data() {
+    if (isExternal()) {
+      m_isPrepared = false;
+    }
+    return isExternal() ? m_extData.get() : _vec.data();
+  }
+  const BasicType* data() const {
+    return isExternal() ? m_extData.get() : _vec.data();
   }
-  typename std::vector<BasicType>::iterator end() {
-    return _vec.end();
+
+  BasicType* begin() {
+    return data();
   }
-  typename std::vector<BasicType>::const_iterator begin() const {
-    return _vec.begin();
+  BasicType* end() {
+    return data() + size();
   }
-  typename std::vector<BasicType>::const_iterator end() const {
-    return _vec.end();
+  const BasicType* begin() const {
+    return data();
+  }
+  const BasicType* end() const {
+    return data() + size();
   }
 
-  typename std::vector<BasicType>::reference operator[](size_t idx) {
-    return _vec[idx];
+  BasicType& operator[](size_t idx) {
+    return data()[idx];
   }
-  typename std::vector<BasicType>::const_reference operator[](size_t idx) const {
-    return _vec[idx];
+  const BasicType& operator[](size_t idx) const {
+    return data()[idx];
   }
 
   void resize(size_t count) {
+    makeOwned();
     _vec.resize(count);
   }
   void push_back(const BasicType& value) {
+    makeOwned();
     _vec.push_back(value);
   }
 
-  /// access to the actual data vector
+  /// access to the actual data vector. External memory is copied into an
+  /// internal std::vector (and released) first
   typename std::vector<BasicType>& vec() {
+    makeOwned();
     return _vec;
   }
 
-  /// const access to the actual data vector
+  /// const access to the actual data vector. For external memory this is the
+  /// copy that is used for writing
   const typename std::vector<BasicType>& vec() const {
+    if (isExternal()) {
+      prepareForWrite();
+      return m_writeVec;
+    }
     return _vec;
   }
+
+private:
+  /// Copy external memory into the internal std::vector and release it
+  void makeOwned() {
+    if (isExternal()) {
+      _vec.assign(m_extData.get(), m_extData.get() + m_extSize);
+      m_extData.reset();
+      m_extSize = 0;
+      m_writeVec.clear();
+      m_isPrepared = false;
+    }
+  }
 };
 
 // don't make this macro public as it should only be used internally here...
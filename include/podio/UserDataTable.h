@@ -0,0 +1,413 @@
+#ifndef PODIO_USERDATATABLE_H
+#define PODIO_USERDATATABLE_H
+
+#include "podio/CollectionBase.h"
+#include "podio/CollectionBuffers.h"
+#include "podio/DatamodelRegistry.h"
+#include "podio/SchemaEvolution.h"
+#include "podio/UserDataCollection.h"
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define PODIO_ADD_USER_TABLE_TYPE(type)                                                                                \
+  template <>                                                                                                          \
+  constexpr const char* userDataTableTypeName<type>() {                                                                \
+    return "podio::UserDataTable<" #type ">";                                                                          \
+  }
+
+namespace podio {
+
+/** Helper template to provide the fully qualified name of a UserDataTable.
+ * Implementations are populated by the PODIO_ADD_USER_TABLE_TYPE macro.
+ */
+template <typename BasicType, typename = EnableIfSupportedUserType<BasicType>>
+constexpr const char* userDataTableTypeName();
+
+PODIO_ADD_USER_TABLE_TYPE(float)
+PODIO_ADD_USER_TABLE_TYPE(double)
+
+PODIO_ADD_USER_TABLE_TYPE(int8_t)
+PODIO_ADD_USER_TABLE_TYPE(int16_t)
+PODIO_ADD_USER_TABLE_TYPE(int32_t)
+PODIO_ADD_USER_TABLE_TYPE(int64_t)
+PODIO_ADD_USER_TABLE_TYPE(uint8_t)
+PODIO_ADD_USER_TABLE_TYPE(uint16_t)
+PODIO_ADD_USER_TABLE_TYPE(uint32_t)
+PODIO_ADD_USER_TABLE_TYPE(uint64_t)
+
+// don't make this macro public as it should only be used internally here...
+#undef PODIO_ADD_USER_TABLE_TYPE
+
+/** Non-owning view of the contiguously stored values of one column of a
+ *  UserDataTable
+ */
+template <typename T>
+class UserDataColumn {
+public:
+  UserDataColumn(T* data, size_t size) : m_data(data), m_size(size) {
+  }
+
+  T* data() const {
+    return m_data;
+  }
+  size_t size() const {
+    return m_size;
+  }
+  bool empty() const {
+    return m_size == 0;
+  }
+  T* begin() const {
+    return m_data;
+  }
+  T* end() const {
+    return m_data + m_size;
+  }
+  T& operator[](size_t idx) const {
+    return m_data[idx];
+  }
+
+private:
+  T* m_data{nullptr};
+  size_t m_size{0};
+};
+
+/** Collection of several named columns of equal length of one basic type for
+ *  additional user data not defined in the EDM. Each column is stored
+ *  contiguously, and all columns are written as one contiguous array (one
+ *  column after the other) together with the column names. Supported are the
+ *  same basic types as for the UserDataCollection - @see SupportedUserDataTypes.
+ *
+ *  The size of the table is its number of rows.
+ */
+template <typename BasicType, typename = EnableIfSupportedUserType<BasicType>>
+class UserDataTable : public CollectionBase {
+
+private:
+  std::vector<std::string> m_columnNames{};
+  std::vector<std::vector<BasicType>> m_columns{};
+  size_t m_nRows{0};
+  // All columns in one contiguous vector for writing, filled in prepareForWrite
+  mutable std::vector<BasicType> m_writeVec{};
+  mutable std::atomic<bool> m_isPrepared{false};
+  mutable std::unique_ptr<std::mutex> m_storageMtx{std::make_unique<std::mutex>()};
+  // Pointers to the actual storage, necessary for I/O. These will be set on
+  // demand during the call to getBuffers
+  std::vector<BasicType>* m_writeVecPtr{nullptr};
+  std::vector<std::string>* m_columnNamesPtr{nullptr};
+  uint32_t m_collectionID{0};
+  CollRefCollection m_refCollections{};
+  VectorMembersInfo m_vecmem_info{};
+
+public:
+  UserDataTable() = default;
+  /// Constructor from the names of all columns
+  explicit UserDataTable(std::vector<std::string> columnNames) {
+    for (const auto& name : columnNames) {
+      addColumn(name);
+    }
+  }
+  /// Constructor from the names of all columns and their values (one column
+  /// after the other)
+  UserDataTable(std::vector<std::string>&& columnNames, const std::vector<BasicType>& values) :
+      m_columnNames(std::move(columnNames)) {
+    if (m_columnNames.empty()) {
+      return;
+    }
+    if (values.size() % m_columnNames.size() != 0) {
+      throw std::invalid_argument("The number of values does not match the number of columns of a UserDataTable");
+    }
+    m_nRows = values.size() / m_columnNames.size();
+    m_columns.reserve(m_columnNames.size());
+    for (size_t i = 0; i < m_columnNames.size(); ++i) {
+      m_columns.emplace_back(values.begin() + i * m_nRows, values.begin() + (i + 1) * m_nRows);
+    }
+  }
+  UserDataTable(const UserDataTable&) = delete;
+  UserDataTable& operator=(const UserDataTable&) = delete;
+
+  // std::atomic is not movable, hence the move operations cannot be defaulted
+  UserDataTable(UserDataTable&& other) noexcept :
+      m_columnNames(std::move(other.m_columnNames)),
+      m_columns(std::move(other.m_columns)),
+      m_nRows(std::exchange(other.m_nRows, 0)),
+      m_writeVec(std::move(other.m_writeVec)),
+      m_isPrepared(other.m_isPrepared.load()),
+      m_storageMtx(std::move(other.m_storageMtx)),
+      m_collectionID(other.m_collectionID),
+      m_refCollections(std::move(other.m_refCollections)),
+      m_vecmem_info(std::move(other.m_vecmem_info)) {
+  }
+
+  UserDataTable& operator=(UserDataTable&& other) noexcept {
+    m_columnNames = std::move(other.m_columnNames);
+    m_columns = std::move(other.m_columns);
+    m_nRows = std::exchange(other.m_nRows, 0);
+    m_writeVec = std::move(other.m_writeVec);
+    m_isPrepared = other.m_isPrepared.load();
+    m_storageMtx = std::move(other.m_storageMtx);
+    m_writeVecPtr = nullptr;
+    m_columnNamesPtr = nullptr;
+    m_collectionID = other.m_collectionID;
+    m_refCollections = std::move(other.m_refCollections);
+    m_vecmem_info = std::move(other.m_vecmem_info);
+    return *this;
+  }
+
+  ~UserDataTable() = default;
+
+  /// The schema version of UserDataTables
+  static constexpr SchemaVersionT schemaVersion = 1;
+
+  constexpr static auto typeName = userDataTableTypeName<BasicType>();
+  // There are no dedicated types for the rows of a table
+  constexpr static auto valueTypeName = userDataTableTypeName<BasicType>();
+  constexpr static auto dataTypeName = userDataTypeName<BasicType>();
+
+  /// prepare buffers for serialization
+  void prepareForWrite() const override {
+    std::lock_guard lock{*m_storageMtx};
+    if (m_isPrepared) {
+      return;
+    }
+    m_writeVec.clear();
+    m_writeVec.reserve(m_columns.size() * m_nRows);
+    for (const auto& column : m_columns) {
+      m_writeVec.insert(m_writeVec.end(), column.begin(), column.end());
+    }
+    m_isPrepared = true;
+  }
+
+  /// re-create collection from buffers after read
+  void prepareAfterRead() override {
+  }
+
+  /// initialize references after read
+  bool setReferences(const ICollectionProvider*) override {
+    return true;
+  }
+
+  /// set collection ID
+  void setID(uint32_t id) override {
+    m_collectionID = id;
+  }
+
+  /// get collection ID
+  uint32_t getID() const override {
+    return m_collectionID;
+  }
+
+  /// Get the collection buffers for this collection
+  podio::CollectionWriteBuffers getBuffers() override {
+    prepareForWrite();
+    m_writeVecPtr = &m_writeVec;
+    m_columnNamesPtr = &m_columnNames;
+    m_vecmem_info = {{"std::string", &m_columnNamesPtr}};
+    return {&m_writeVecPtr, m_writeVecPtr, &m_refCollections, &m_vecmem_info};
+  }
+
+  /// check for validity of the container after read
+  bool isValid() const override {
+    return true;
+  }
+
+  /// number of rows in the table
+  size_t size() const override {
+    return m_nRows;
+  }
+
+  /// Is the table empty
+  bool empty() const override {
+    return m_nRows == 0;
+  }
+
+  /// fully qualified type name
+  const std::string_view getTypeName() const override {
+    return typeName;
+  }
+
+  /// fully qualified type name of elements - with namespace
+  const std::string_view getValueTypeName() const override {
+    return valueTypeName;
+  }
+
+  /// fully qualified type name of stored POD elements - with namespace
+  const std::string_view getDataTypeName() const override {
+    return dataTypeName;
+  }
+
+  /// clear all rows of the table (but keep the columns)
+  void clear() override {
+    for (auto& column : m_columns) {
+      column.clear();
+    }
+    m_nRows = 0;
+    m_writeVec.clear();
+    m_isPrepared = false;
+  }
+
+  /// check if this collection is a subset collection - no subset possible
+  bool isSubsetCollection() const override {
+    return false;
+  }
+
+  /// declare this collection to be a subset collection - no effect
+  void setSubsetCollection(bool) override {
+  }
+
+  /// The schema version is fixed manually
+  SchemaVersionT getSchemaVersion() const final {
+    return schemaVersion;
+  }
+
+  /// Print this table to the passed stream
+  void print(std::ostream& os = std::cout, bool flush = true) const override {
+    os << "{";
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+      os << (i == 0 ? "" : ", ") << m_columnNames[i] << ": [";
+      for (size_t j = 0; j < m_nRows; ++j) {
+        os << (j == 0 ? "" : ", ") << m_columns[i][j];
+      }
+      os << "]";
+    }
+    os << "}";
+
+    if (flush) {
+      os.flush(); // Necessary for python
+    }
+  }
+
+  /// Nothing to release, since the data is used directly from the I/O buffers
+  void releaseIOBuffers() override {
+  }
+
+  size_t getDatamodelRegistryIndex() const override {
+    return DatamodelRegistry::NoDefinitionNecessary;
+  }
+
+  /// Get the (approximate) heap memory that is used by this table
+  podio::MemoryUsage memoryUsage() const override {
+    auto usage = podio::MemoryUsage{};
+    usage.payload = utils::memoryOf(m_columns);
+    for (const auto& column : m_columns) {
+      usage.payload += utils::memoryOf(column);
+    }
+    usage.ioBuffers = utils::memoryOf(m_writeVec);
+    return usage;
+  }
+
+  // ----- columns
+
+  /// The names of all columns
+  const std::vector<std::string>& columnNames() const {
+    return m_columnNames;
+  }
+
+  /// The number of columns
+  size_t numColumns() const {
+    return m_columns.size();
+  }
+
+  /// Check whether there is a column with the given name
+  bool hasColumn(const std::string& name) const {
+    return std::find(m_columnNames.begin(), m_columnNames.end(), name) != m_columnNames.end();
+  }
+
+  /// Add a column and get its index back. Existing rows get a default
+  /// initialized value in this column
+  size_t addColumn(const std::string& name) {
+    if (hasColumn(name)) {
+      throw std::invalid_argument("UserDataTable already has a column '" + name + "'");
+    }
+    m_columnNames.emplace_back(name);
+    m_columns.emplace_back(m_nRows);
+    m_isPrepared = false;
+    return m_columns.size() - 1;
+  }
+
+  /// Access the values of a column by index
+  UserDataColumn<BasicType> column(size_t idx) {
+    m_isPrepared = false;
+    auto& column = m_columns.at(idx);
+    return {column.data(), column.size()};
+  }
+  /// Access the values of a column by index
+  UserDataColumn<const BasicType> column(size_t idx) const {
+    const auto& column = m_columns.at(idx);
+    return {column.data(), column.size()};
+  }
+  /// Access the values of a column by name
+  UserDataColumn<BasicType> column(const std::string& name) {
+    return column(columnIndex(name));
+  }
+  /// Access the values of a column by name
+  UserDataColumn<const BasicType> column(const std::string& name) const {
+    return column(columnIndex(name));
+  }
+
+  // ----- rows
+
+  /// Add a row with one value per column
+  void push_back(std::initializer_list<BasicType> row) {
+    pushRow(row.begin(), row.end(), row.size());
+  }
+  /// Add a row with one value per column
+  void push_back(const std::vector<BasicType>& row) {
+    pushRow(row.begin(), row.end(), row.size());
+  }
+
+  /// Change the number of rows, new rows are default initialized
+  void resize(size_t count) {
+    for (auto& column : m_columns) {
+      column.resize(count);
+    }
+    m_nRows = count;
+    m_isPrepared = false;
+  }
+
+  /// Reserve space for count rows in all columns
+  void reserve(size_t count) {
+    for (auto& column : m_columns) {
+      column.reserve(count);
+    }
+  }
+
+private:
+  size_t columnIndex(const std::string& name) const {
+    const auto it = std::find(m_columnNames.begin(), m_columnNames.end(), name);
+    if (it == m_columnNames.end()) {
+      throw std::out_of_range("UserDataTable has no column '" + name + "'");
+    }
+    return std::distance(m_columnNames.begin(), it);
+  }
+
+  template <typename IterT>
+  void pushRow(IterT begin, IterT end, size_t nValues) {
+    if (nValues != m_columns.size()) {
+      throw std::invalid_argument("A row of a UserDataTable needs exactly one value per column");
+    }
+    auto column = m_columns.begin();
+    for (auto it = begin; it != end; ++it, ++column) {
+      column->push_back(*it);
+    }
+    ++m_nRows;
+    m_isPrepared = false;
+  }
+};
+
+template <typename BasicType, typename = EnableIfSupportedUserType<BasicType>>
+std::ostream& operator<<(std::ostream& o, const podio::UserDataTable<BasicType>& table) {
+  table.print(o);
+  return o;
+}
+
+} // namespace podio
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef PODIO_UTILITIES_BUFFERVIEWS_H
+#define PODIO_UTILITIES_BUFFERVIEWS_H
+
+#include "podio/CollectionBuffers.h"
+#include "podio/ObjectID.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace podio::utils {
+
+/// The address and the number of elements of a contiguous I/O buffer. Mainly
+/// intended for zero-copy access to the buffers of a collection from python
+struct BufferView {
+  std::uintptr_t address{0};
+  size_t size{0};
+};
+
+/// Get the view of size contiguously stored elements
+template <typename T>
+BufferView makeBufferView(const T* data, size_t size) {
+  return {reinterpret_cast<std::uintptr_t>(data), size};
+}
+
+/// Get the view of a type-erased buffer of the CollectionWriteBuffers (i.e.
+/// the data or a vector member buffer), which is stored as std::vector<T>
+template <typename T>
+BufferView writeBufferView(void* raw) {
+  const auto* vec = podio::CollectionWriteBuffers::asVector<T>(raw);
+  return {reinterpret_cast<std::uintptr_t>(vec->data()), vec->size()};
+}
+
+/// Get the view of the ObjectIDs of the i-th relation of the CollectionWriteBuffers
+inline BufferView relationBufferView(const podio::CollectionWriteBuffers& buffers, size_t i) {
+  const auto& ids = (*buffers.references)[i];
+  return {reinterpret_cast<std::uintptr_t>(ids->data()), ids->size()};
+}
+
+} // namespace podio::utils
+
+#endif // PODIO_UTILITIES_BUFFERVIEWS_H
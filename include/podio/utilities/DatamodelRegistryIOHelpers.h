@@ -71,6 +71,20 @@ protected:
   MapType m_availEDMDefs{};
 };
 
+/**
+ * Merge the datamodel definitions read from another file into the passed ones.
+ * Definitions are identified by the datamodel name and only the first one is
+ * kept for every name.
+ *
+ * @param definitions The definitions into which the others are merged
+ * @param toMerge     The definitions that should be merged
+ *
+ * @returns false if any of the definitions to merge differs from an already
+ *          present definition for the same datamodel name, true otherwise
+ */
+bool mergeDatamodelDefinitions(DatamodelDefinitionHolder::MapType& definitions,
+                               const DatamodelDefinitionHolder::MapType& toMerge);
+
 } // namespace podio
 
 #endif // PODIO_UTILITIES_DATAMODELREGISTRYIOHELPERS_H
@@ -0,0 +1,84 @@
+#ifndef PODIO_UTILITIES_DEFERREDRELATIONS_H
+#define PODIO_UTILITIES_DEFERREDRELATIONS_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace podio::utils {
+
+/// Book-keeping for the deferred resolution of the relations of a collection
+/// that has been read. Instead of resolving all relations directly when a
+/// collection is retrieved from a Frame (which forces all related collections
+/// to be unpacked as well), each relation is resolved the first time it is
+/// accessed:
+/// - The related collections are looked up for the whole collection at once
+///   for each relation (multi resolution). This is all that is necessary for
+///   OneToManyRelations, since all objects of a collection share the same
+///   relation storage.
+/// - OneToOneRelations are additionally resolved for each object individually
+///   (single resolution).
+///
+/// Resolution is thread-safe and happens exactly once per relation (and
+/// object). The resolution functions must only capture things that stay valid
+/// for the lifetime of the collection, even if it is moved.
+template <typename ObjT>
+class DeferredRelations {
+public:
+  using MultiResolveFuncT = std::function<void()>;
+  using SingleResolveFuncT = std::function<void(ObjT*)>;
+
+  /// Constructor from the multi resolution functions of all relations (all
+  /// OneToManyRelations followed by all OneToOneRelations), the single
+  /// resolution functions of all OneToOneRelations and the number of objects
+  /// for which the OneToOneRelations can be resolved
+  DeferredRelations(std::vector<MultiResolveFuncT>&& multiFuncs, std::vector<SingleResolveFuncT>&& singleFuncs,
+                    size_t nObjects) :
+      m_multiFuncs(std::move(multiFuncs)),
+      m_singleFuncs(std::move(singleFuncs)),
+      m_multiFlags(std::make_unique<std::once_flag[]>(m_multiFuncs.size())),
+      m_singleFlags(std::make_unique<std::once_flag[]>(m_singleFuncs.size() * nObjects)),
+      m_nObjects(nObjects) {
+  }
+
+  DeferredRelations(const DeferredRelations&) = delete;
+  DeferredRelations& operator=(const DeferredRelations&) = delete;
+  DeferredRelations(DeferredRelations&&) = delete;
+  DeferredRelations& operator=(DeferredRelations&&) = delete;
+  ~DeferredRelations() = default;
+
+  /// Resolve the OneToManyRelation with the given index (for all objects)
+  void resolveMulti(size_t iRelation) const {
+    std::call_once(m_multiFlags[iRelation], m_multiFuncs[iRelation]);
+  }
+
+  /// Resolve the OneToOneRelation with the given index for the passed object
+  void resolveSingle(size_t iRelation, ObjT* obj) const {
+    resolveMulti(m_multiFuncs.size() - m_singleFuncs.size() + iRelation);
+    std::call_once(m_singleFlags[iRelation * m_nObjects + obj->id.index], m_singleFuncs[iRelation], obj);
+  }
+
+  /// Resolve all relations that are necessary to fully populate the passed
+  /// object
+  void resolveAll(ObjT* obj) const {
+    for (size_t i = 0; i < m_multiFuncs.size(); ++i) {
+      resolveMulti(i);
+    }
+    for (size_t i = 0; i < m_singleFuncs.size(); ++i) {
+      resolveSingle(i, obj);
+    }
+  }
+
+private:
+  std::vector<MultiResolveFuncT> m_multiFuncs{};     ///< The resolution functions for all relations
+  std::vector<SingleResolveFuncT> m_singleFuncs{};   ///< The resolution functions for the OneToOneRelations
+  std::unique_ptr<std::once_flag[]> m_multiFlags{};  ///< Flags for resolving each relation only once
+  std::unique_ptr<std::once_flag[]> m_singleFlags{}; ///< Flags for resolving each OneToOneRelation once per object
+  size_t m_nObjects{0};                              ///< The number of objects with deferred OneToOneRelations
+};
+
+} // namespace podio::utils
+
+#endif // PODIO_UTILITIES_DEFERREDRELATIONS_H
@@ -0,0 +1,102 @@
+#ifndef PODIO_UTILITIES_PACKEDRELATION_H
+#define PODIO_UTILITIES_PACKEDRELATION_H
+
+#include "podio/ObjectID.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace podio {
+class CollectionBase;
+}
+
+namespace podio::utils {
+
+/// Get the object with the given index from a collection of type CollT as
+/// ReferenceType (which is either the immutable type of CollT or an interface
+/// type that can be initialized from it)
+template <typename CollT, typename ReferenceType>
+ReferenceType getFromCollection(const podio::CollectionBase* coll, int index) {
+  return ReferenceType((*static_cast<const CollT*>(coll))[index]);
+}
+
+/// Compact storage for a relation of a collection that has been read.
+///
+/// The relations of all objects of a collection are stored in one packed vector
+/// of ObjectIDs, which is the same vector that is used for I/O. For
+/// OneToManyRelations this is compressed sparse row form, where the begin and
+/// end members of each object are the row offsets. For OneToOneRelations there
+/// is exactly one ObjectID per object. Instead of keeping a handle for every
+/// related object, only the (few) related collections are kept, together with
+/// a function to get objects of their concrete type. The concrete type of each
+/// related collection has to be determined only once and handles are created
+/// on access.
+template <typename ReferenceType>
+class PackedRelation {
+public:
+  /// Function for getting an object from a (type-erased) related collection
+  using GetFuncT = ReferenceType (*)(const podio::CollectionBase*, int);
+
+  /// Constructor from the packed ObjectIDs of all objects of a collection
+  explicit PackedRelation(const std::vector<podio::ObjectID>* ids) :
+      m_ids(ids), m_empty(ReferenceType::makeEmpty()) {
+  }
+
+  PackedRelation(const PackedRelation&) = delete;
+  PackedRelation& operator=(const PackedRelation&) = delete;
+  PackedRelation(PackedRelation&&) = delete;
+  PackedRelation& operator=(PackedRelation&&) = delete;
+  ~PackedRelation() = default;
+
+  /// The packed ObjectIDs of all objects of the collection
+  const std::vector<podio::ObjectID>& objectIDs() const {
+    return *m_ids;
+  }
+
+  /// Check whether a related collection has already been added
+  bool hasCollection(uint32_t collectionID) const {
+    for (const auto& target : m_targets) {
+      if (target.collectionID == collectionID) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Add a related collection and the function to get objects from it. Passing
+  /// a nullptr marks a related collection as not available.
+  void addCollection(uint32_t collectionID, const podio::CollectionBase* coll, GetFuncT getFunc) {
+    m_targets.push_back({collectionID, coll, getFunc});
+  }
+
+  /// Get the related object at position i of the packed ObjectIDs
+  ReferenceType get(size_t i) const {
+    const auto& id = (*m_ids)[i];
+    for (const auto& target : m_targets) {
+      if (target.collectionID == id.collectionID) {
+        if (target.collection && id.index != podio::ObjectID::invalid) {
+          return target.getFunc(target.collection, id.index);
+        }
+        break;
+      }
+    }
+    return m_empty;
+  }
+
+private:
+  /// A related collection
+  struct Target {
+    uint32_t collectionID{};
+    const podio::CollectionBase* collection{nullptr};
+    GetFuncT getFunc{nullptr};
+  };
+
+  const std::vector<podio::ObjectID>* m_ids{nullptr}; ///< The packed ObjectIDs of all objects
+  std::vector<Target> m_targets{};                    ///< The related collections
+  ReferenceType m_empty;                              ///< Returned for unavailable related objects
+};
+
+} // namespace podio::utils
+
+#endif // PODIO_UTILITIES_PACKEDRELATION_H
@@ -0,0 +1,104 @@
+#ifndef PODIO_UTILITIES_PARAMETERSASJSON_H
+#define PODIO_UTILITIES_PARAMETERSASJSON_H
+
+#include "podio/GenericParameters.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace podio::utils {
+
+namespace detail {
+  inline void appendJSON(std::string& out, int value) {
+    out += std::to_string(value);
+  }
+
+  /// floats are written with the precision of a double to get exactly the same
+  /// value as when converting them to a python float directly
+  inline void appendJSON(std::string& out, double value) {
+    if (std::isnan(value)) {
+      out += "NaN";
+    } else if (std::isinf(value)) {
+      out += value > 0 ? "Infinity" : "-Infinity";
+    } else {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+      out += buffer;
+    }
+  }
+
+  inline void appendJSON(std::string& out, const std::string& value) {
+    out += '"';
+    for (const unsigned char c : value) {
+      if (c == '"' || c == '\\') {
+        out += '\\';
+        out += c;
+      } else if (c < 0x20) {
+        char buffer[8];
+        std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+        out += buffer;
+      } else {
+        out += c;
+      }
+    }
+    out += '"';
+  }
+
+  template <typename T>
+  constexpr const char* parameterTypeName() {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return "std::string";
+    } else if constexpr (std::is_same_v<T, int>) {
+      return "int";
+    } else if constexpr (std::is_same_v<T, float>) {
+      return "float";
+    } else {
+      return "double";
+    }
+  }
+
+  template <typename T>
+  void appendParameters(std::string& out, const podio::GenericParameters& params) {
+    for (const auto& key : params.getKeys<T>()) {
+      if (out.size() > 1) {
+        out += ',';
+      }
+      out += '[';
+      appendJSON(out, key);
+      out += ",\"";
+      out += parameterTypeName<T>();
+      out += "\",[";
+      const auto& values = params.getValue<std::vector<T>>(key);
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+          out += ',';
+        }
+        appendJSON(out, values[i]);
+      }
+      out += "]]";
+    }
+  }
+
+  template <typename... Ts>
+  void appendAllParameters(std::string& out, const podio::GenericParameters& params, std::tuple<Ts...>*) {
+    (appendParameters<Ts>(out, params), ...);
+  }
+} // namespace detail
+
+/// Get all parameters as one JSON array of [key, type, [values...]] entries,
+/// ordered by the types in SupportedGenericDataTypes and then by key. Mainly
+/// intended for getting all parameters into python with a single call
+inline std::string parametersAsJSON(const podio::GenericParameters& params) {
+  std::string out = "[";
+  detail::appendAllParameters(out, params, static_cast<podio::SupportedGenericDataTypes*>(nullptr));
+  out += ']';
+  return out;
+}
+
+} // namespace podio::utils
+
+#endif // PODIO_UTILITIES_PARAMETERSASJSON_H
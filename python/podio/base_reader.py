@@ -3,6 +3,8 @@
 backend specific bindings"""
 
 
+import ROOT
+
 from podio.frame_iterator import FrameCategoryIterator
 
 
@@ -67,6 +69,72 @@ class BaseReaderMixin:
             return ()
         return tuple(n.c_str() for n in self._reader.getAvailableDatamodels())
 
+    def enable_io_stats(self, enable=True):
+        """Enable (or disable) recording I/O statistics for all Frames that are
+        read from now on.
+
+        Args:
+            enable (bool): Whether to record the statistics or not
+        """
+        if self._is_legacy:
+            raise RuntimeError("I/O statistics are not available for legacy readers")
+        self._reader.enableIOStats(enable)
+
+    @property
+    def io_stats(self):
+        """Get the I/O statistics that have been recorded so far.
+
+        Returns:
+            dict: The statistics for each category, split into the "frame" level
+                data and the "collections" (keyed by their name). Each of these
+                is a dict with the number of entries, the (un)compressed bytes
+                and the times (in seconds). Empty if no statistics are recorded.
+        """
+        if self._is_legacy:
+            return {}
+        stats = self._reader.getIOStats()
+        if not stats:
+            return {}
+
+        def _to_dict(coll_stats):
+            return {
+                "entries": coll_stats.nEntries,
+                "compressed_bytes": coll_stats.compressedBytes,
+                "uncompressed_bytes": coll_stats.uncompressedBytes,
+                "compression_time": coll_stats.compressionTime.count() * 1e-9,
+                "serialization_time": coll_stats.serializationTime.count() * 1e-9,
+                "prepare_time": coll_stats.prepareTime.count() * 1e-9,
+                "set_references_time": coll_stats.setReferencesTime.count() * 1e-9,
+            }
+
+        return {
+            cat.first.c_str(): {
+                "frame": _to_dict(cat.second.frame),
+                "collections": {
+                    coll.first.c_str(): _to_dict(coll.second) for coll in cat.second.collections
+                },
+            }
+            for cat in stats.get()
+        }
+
+    def release_io_buffers(self, release=True):
+        """Release (or keep) the I/O buffers of collections of all Frames that are
+        read from now on, once the collections have been unpacked.
+
+        Releasing them reduces the memory usage of jobs that only read
+        collections, but they have to be prepared again for writing.
+
+        Args:
+            release (bool): Whether to release the buffers or not
+
+        Raises:
+            RuntimeError: If the reader is a legacy reader
+        """
+        if self._is_legacy:
+            raise RuntimeError("Releasing I/O buffers is not supported for legacy readers")
+        policy = ROOT.podio.IOBufferPolicy
+        self._reader.setIOBufferPolicy(policy.Release if release else policy.Keep)
+
     def get_datamodel_definition(self, edm_name):
         """Get the datamodel definition as JSON string.
 
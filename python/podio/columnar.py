@@ -0,0 +1,363 @@
+#!/usr/bin/env python3
+"""Module for zero-copy columnar access to the data of podio collections.
+
+The (I/O) buffers of a collection are exposed as numpy arrays without copying
+them. The POD data of all elements is exposed as a structured array, with one
+field per member (including the begin and end indices of vector members and
+OneToManyRelations). The contents of vector members and the ObjectIDs of
+relations are exposed as flat arrays that can be indexed with these.
+
+Building on these views collections can also be exported to Arrow record
+batches (with pyarrow) and to Awkward arrays (with awkward), where vector
+members and relations become list arrays.
+
+NOTE: The returned arrays are views into memory that is owned by the
+collection. They keep the collection (and the Frame it has been obtained from
+via podio.frame.Frame.get) alive, but they are only valid as long as the
+collection is not modified. Since only the buffers of collections that have
+been read reflect their contents, collections of datatypes that have been
+created in python (or whose buffers have been released) cannot be accessed.
+"""
+
+import ctypes
+import functools
+import re
+
+import ROOT
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+try:
+    import pyarrow as pa
+except ImportError:
+    pa = None
+
+try:
+    import awkward as ak
+except ImportError:
+    ak = None
+
+# NOTE: It is necessary that this can be found on the ROOT_INCLUDE_PATH
+if ROOT.gInterpreter.LoadFile("podio/utilities/BufferViews.h") == 0:  # noqa: E402
+    from ROOT import podio  # noqa: E402 # pylint: disable=wrong-import-position
+
+# numpy character codes of the c++ builtin types
+_BUILTIN_TYPE_CODES = {
+    "bool": "?",
+    "char": "b",
+    "signed char": "b",
+    "unsigned char": "B",
+    "short": "h",
+    "unsigned short": "H",
+    "int": "i",
+    "unsigned int": "I",
+    "long": "l",
+    "unsigned long": "L",
+    "long long": "q",
+    "unsigned long long": "Q",
+    "float": "f",
+    "double": "d",
+}
+
+_ARRAY_TYPE_RE = re.compile(r"^(?:std::)?array<(.+),\s*(\d+)[uUlL]*>$")
+
+
+def _require_numpy():
+    """Raise an ImportError if numpy is not available."""
+    if np is None:
+        raise ImportError("numpy is necessary for columnar access to podio collections")
+
+
+@functools.lru_cache(maxsize=None)
+def get_dtype(type_name):
+    """Get the numpy dtype corresponding to the memory layout of a c++ type.
+
+    Args:
+        type_name (str): The (fully qualified) c++ type name, e.g. ExampleHitData
+
+    Returns:
+        numpy.dtype: A dtype with the same memory layout as the c++ type. For
+            classes this is a structured dtype with one field per data member
+
+    Raises:
+        TypeError: If the memory layout of the type cannot be determined
+    """
+    _require_numpy()
+    type_name = type_name.strip()
+    if type_name in _BUILTIN_TYPE_CODES:
+        return np.dtype(_BUILTIN_TYPE_CODES[type_name])
+
+    array_match = _ARRAY_TYPE_RE.match(type_name)
+    if array_match:
+        return np.dtype((get_dtype(array_match.group(1)), (int(array_match.group(2)),)))
+
+    cls = ROOT.TClass.GetClass(type_name)
+    if not cls:
+        raise TypeError(f"Cannot determine the memory layout of {type_name}")
+
+    names, formats, offsets = [], [], []
+    for member in cls.GetListOfDataMembers():
+        if member.Property() & ROOT.kIsStatic:
+            continue
+        if member.IsEnum():
+            dtype = np.dtype("i")
+        else:
+            dtype = get_dtype(member.GetTrueTypeName())
+        dims = tuple(member.GetMaxIndex(i) for i in range(member.GetArrayDim()))
+        names.append(str(member.GetName()))
+        formats.append(np.dtype((dtype, dims)) if dims else dtype)
+        offsets.append(member.GetOffset())
+
+    return np.dtype(
+        {"names": names, "formats": formats, "offsets": offsets, "itemsize": cls.Size()}
+    )
+
+
+def _as_array(buffer_view, dtype, owner):
+    """Create a read-only numpy array from a podio::utils::BufferView without copying.
+
+    The array (and everything that is created from it without copying) keeps a
+    reference to the owner of the memory.
+    """
+    if buffer_view.size == 0:
+        return np.empty(0, dtype=dtype)
+    raw = (ctypes.c_char * (buffer_view.size * dtype.itemsize)).from_address(buffer_view.address)
+    raw.owner = owner
+    array = np.frombuffer(raw, dtype=dtype)
+    array.flags.writeable = False
+    return array
+
+
+def _is_user_data_table(collection):
+    """Check whether the passed collection is a podio::UserDataTable"""
+    return str(collection.getTypeName()).startswith("podio::UserDataTable")
+
+
+def _get_buffers(collection):
+    """Get the I/O buffers of a collection that has been read.
+
+    Raises:
+        ValueError: If the collection has not been read or its I/O buffers have
+            been released
+    """
+    if not collection.hasReadBuffers():
+        raise ValueError(
+            f"Columnar access to a {collection.getTypeName()} is only possible if it has been read"
+            " and its I/O buffers have not been released"
+        )
+    return collection.getBuffers()
+
+
+def _table_columns(table):
+    """Get all columns of a podio::UserDataTable"""
+    return {str(name): column(table, str(name)) for name in table.columnNames()}
+
+
+def to_numpy(collection):
+    """Get the data of all elements of a collection as numpy array without copying.
+
+    Args:
+        collection (podio.CollectionBase): The collection
+
+    Returns:
+        numpy.ndarray: A structured array with one field per member for
+            collections of datatypes, the ObjectIDs of the elements for subset
+            collections and a flat array for a podio::UserDataCollection. For a
+            podio::UserDataTable a dict with one array per column is returned
+    """
+    _require_numpy()
+    if _is_user_data_table(collection):
+        return _table_columns(collection)
+
+    data_type = str(collection.getDataTypeName())
+    if str(collection.getTypeName()).startswith("podio::UserDataCollection"):
+        buffer_view = podio.utils.makeBufferView[data_type](collection.data(), collection.size())
+        return _as_array(buffer_view, get_dtype(data_type), collection)
+
+    buffers = _get_buffers(collection)
+    if collection.isSubsetCollection():
+        buffer_view = podio.utils.relationBufferView(buffers, 0)
+        return _as_array(buffer_view, get_dtype("podio::ObjectID"), collection)
+
+    buffer_view = podio.utils.writeBufferView[data_type](buffers.data)
+    return _as_array(buffer_view, get_dtype(data_type), collection)
+
+
+def column(collection, name):
+    """Get one column of a collection as numpy array without copying.
+
+    Args:
+        collection (podio.CollectionBase): The collection
+        name (str): The name of a member, vector member or relation, or the
+            name of a column for a podio::UserDataTable
+
+    Returns:
+        numpy.ndarray: The (strided) values of a member for all elements, the
+            values of a vector member for all elements, or the ObjectIDs of a
+            relation for all elements. The latter two can be indexed by the
+            <name>_begin and <name>_end members (for OneToManyRelations and
+            vector members)
+
+    Raises:
+        KeyError: If there is no such column
+    """
+    _require_numpy()
+    if _is_user_data_table(collection):
+        if not collection.hasColumn(name):
+            raise KeyError(f"UserDataTable has no column '{name}'")
+        data_type = str(collection.getDataTypeName())
+        values = collection.column(name)
+        buffer_view = podio.utils.makeBufferView[data_type](values.data(), values.size())
+        return _as_array(buffer_view, get_dtype(data_type), collection)
+
+    data = to_numpy(collection)
+    if data.dtype.names and name in data.dtype.names:
+        return data[name]
+
+    buffers = _get_buffers(collection)
+    rel_names = podio.DatamodelRegistry.instance().getRelationNames(collection.getValueTypeName())
+    vec_members = [str(n) for n in rel_names.vectorMembers]
+    if name in vec_members:
+        vec_member = buffers.vectorMembers.at(vec_members.index(name))
+        type_name = str(vec_member.first)
+        buffer_view = podio.utils.writeBufferView[type_name](vec_member.second)
+        return _as_array(buffer_view, get_dtype(type_name), collection)
+
+    relations = [str(n) for n in rel_names.relations]
+    if name in relations:
+        buffer_view = podio.utils.relationBufferView(buffers, relations.index(name))
+        return _as_array(buffer_view, get_dtype("podio::ObjectID"), collection)
+
+    raise KeyError(f"{collection.getTypeName()} has no column '{name}'")
+
+
+def _require_pyarrow():
+    """Raise an ImportError if pyarrow (or numpy) is not available."""
+    _require_numpy()
+    if pa is None:
+        raise ImportError("pyarrow is necessary for exporting podio collections to Arrow")
+
+
+def _to_arrow_array(values):
+    """Convert a numpy array into an arrow array.
+
+    Contiguous arrays of numeric types (except bool) are wrapped without
+    copying and keep the memory they point to alive. Structured arrays become
+    struct arrays and multi-dimensional arrays (i.e. std::array members) become
+    fixed size list arrays. Since the fields of a structured array are strided
+    views, they are copied into a contiguous array each, unless the struct has
+    only one member.
+    """
+    if values.dtype.names:
+        children = [_to_arrow_array(values[name]) for name in values.dtype.names]
+        return pa.StructArray.from_arrays(children, names=list(values.dtype.names))
+    if values.ndim > 1:
+        flat = _to_arrow_array(np.ascontiguousarray(values).reshape(-1, *values.shape[2:]))
+        return pa.FixedSizeListArray.from_arrays(flat, values.shape[1])
+    return pa.array(np.ascontiguousarray(values))
+
+
+def _list_offsets(begin, end):
+    """Get the arrow list offsets from the begin and end indices of a vector
+    member or OneToManyRelation"""
+    if len(begin) == 0:
+        return pa.array(np.zeros(1, dtype=np.int32))
+    if np.any(begin[1:] != end[:-1]):
+        raise ValueError("The ranges of vector members or relations are not contiguous")
+    return pa.array(np.append(begin, end[-1]).astype(np.int32))
+
+
+def to_arrow(collection):
+    """Export the data of a collection to an arrow RecordBatch.
+
+    Contiguous buffers (the values of vector members, the ObjectIDs of
+    relations and the data of user data collections) are exported without
+    copying, and the exported arrays keep the collection alive. The members of
+    datatypes (and of the ObjectIDs) are stored as array of structs, hence they
+    are copied into one contiguous array each.
+
+    Args:
+        collection (podio.CollectionBase): The collection
+
+    Returns:
+        pyarrow.RecordBatch: A record batch with one row per element. Vector
+            members become list arrays of their values, OneToManyRelations list
+            arrays and OneToOneRelations struct arrays of the ObjectIDs (index
+            and collectionID) of the related objects. Subset collections have
+            the index and collectionID columns of the ObjectIDs. A
+            podio::UserDataCollection has one values column and a
+            podio::UserDataTable one column per column of the table
+    """
+    _require_pyarrow()
+    if _is_user_data_table(collection):
+        columns = _table_columns(collection)
+        return pa.RecordBatch.from_arrays(
+            [_to_arrow_array(values) for values in columns.values()], names=list(columns)
+        )
+
+    data = to_numpy(collection)
+    if not data.dtype.names:
+        return pa.RecordBatch.from_arrays([_to_arrow_array(data)], names=["values"])
+    if collection.isSubsetCollection():
+        return pa.RecordBatch.from_struct_array(_to_arrow_array(data))
+
+    rel_names = podio.DatamodelRegistry.instance().getRelationNames(collection.getValueTypeName())
+    list_names = [str(n) for n in rel_names.vectorMembers] + [str(n) for n in rel_names.relations]
+
+    index_fields = {f"{name}_{idx}" for name in list_names for idx in ("begin", "end")}
+    names = [name for name in data.dtype.names if name not in index_fields]
+    arrays = [_to_arrow_array(data[name]) for name in names]
+    for name in list_names:
+        values = _to_arrow_array(column(collection, name))
+        if f"{name}_begin" in data.dtype.names:
+            offsets = _list_offsets(data[f"{name}_begin"], data[f"{name}_end"])
+            values = pa.ListArray.from_arrays(offsets, values)
+        names.append(name)
+        arrays.append(values)
+
+    return pa.RecordBatch.from_arrays(arrays, names=names)
+
+
+def to_awkward(collection):
+    """Export the data of a collection to an awkward Array.
+
+    Args:
+        collection (podio.CollectionBase): The collection
+
+    Returns:
+        awkward.Array: An array of records with the same fields as the
+            RecordBatch returned by to_arrow
+    """
+    if ak is None:
+        raise ImportError("awkward is necessary for exporting podio collections to awkward arrays")
+    return ak.from_arrow(to_arrow(collection))
+
+
+# The collection types that have already been equipped with columnar access
+_COLUMNAR_TYPES = set()
+
+
+def add_columnar_access(collection_type):
+    """Add the to_numpy, column, to_arrow and to_awkward functions as methods
+    to a collection type.
+
+    Existing methods of the collection type (e.g. UserDataTable::column) are
+    not replaced.
+
+    Args:
+        collection_type (type): The (python proxy) type of a podio collection
+    """
+    if collection_type in _COLUMNAR_TYPES:
+        return
+    _COLUMNAR_TYPES.add(collection_type)
+    for name, func in (
+        ("to_numpy", to_numpy),
+        ("column", column),
+        ("to_arrow", to_arrow),
+        ("to_awkward", to_awkward),
+    ):
+        if not hasattr(collection_type, name):
+            setattr(collection_type, name, func)
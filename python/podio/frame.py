@@ -1,10 +1,14 @@
 #!/usr/bin/env python3
 """Module for the python bindings of the podio::Frame"""
 
+import json
+
 import cppyy
 
 import ROOT
 
+from podio.columnar import add_columnar_access, to_arrow, to_awkward
+
 # NOTE: It is necessary that this can be found on the ROOT_INCLUDE_PATH
 #
 # We check whether we can actually load the header to not break python bindings
@@ -13,6 +17,7 @@ if ROOT.gInterpreter.LoadFile("podio/Frame.h") == 0:  # noqa: E402
     from ROOT import podio  # noqa: E402 # pylint: disable=wrong-import-position
 
     _FRAME_HEADER_AVAILABLE = True
+    ROOT.gInterpreter.LoadFile("podio/utilities/ParametersAsJSON.h")
 else:
     _FRAME_HEADER_AVAILABLE = False
 
@@ -52,24 +57,49 @@ def _determine_supported_parameter_types():
     return tuple(zip(cpp_types, py_types))
 
 
+def _build_type_maps(supported_types):
+    """Build the maps from all c++ and python type names to the supported types.
+
+    Args:
+        supported_types (tuple(tuple(str, str))): The c++ and python type names
+            of all supported parameter types
+
+    Returns:
+        tuple(dict, dict): The (c++ type, python type) tuples and the
+            std::vector<c++ type> names that correspond to a (c++ or python)
+            type name
+    """
+    cpp_types = {}
+    for types in supported_types:
+        for type_name in dict.fromkeys(types):
+            cpp_types.setdefault(type_name, []).append(types)
+
+    cpp_types = {name: tuple(types) for name, types in cpp_types.items()}
+    vector_types = {
+        name: tuple(f"std::vector<{cpp}>" for cpp, _ in types) for name, types in cpp_types.items()
+    }
+    return cpp_types, vector_types
+
+
 if _FRAME_HEADER_AVAILABLE:
     SUPPORTED_PARAMETER_TYPES = _determine_supported_parameter_types()
+    _CPP_TYPES, _CPP_VECTOR_TYPES = _build_type_maps(SUPPORTED_PARAMETER_TYPES)
 
 
 def _get_cpp_types(type_str):
     """Get all possible c++ types from the passed py_type string."""
-    types = list(filter(lambda t: type_str in t, SUPPORTED_PARAMETER_TYPES))
-    if not types:
-        raise ValueError(f"{type_str} cannot be mapped to a valid parameter type")
-
-    return types
+    try:
+        return _CPP_TYPES[type_str]
+    except KeyError:
+        raise ValueError(f"{type_str} cannot be mapped to a valid parameter type") from None
 
 
 def _get_cpp_vector_types(type_str):
     """Get the possible std::vector<cpp_type> from the passed py_type string."""
-    # Gather a list of all types that match the type_str (c++ or python)
-    types = _get_cpp_types(type_str)
-    return [f"std::vector<{t}>" for t in map(lambda x: x[0], types)]
+    try:
+        return _CPP_VECTOR_TYPES[type_str]
+    except KeyError:
+        raise ValueError(f"{type_str} cannot be mapped to a valid parameter type") from None
 
 
 def _is_collection_base(thing):
@@ -100,15 +130,21 @@ class Frame:
         """Create a Frame.
 
         Args:
-            data (FrameData, optional): Almost arbitrary FrameData, e.g. from file
+            data (FrameData, optional): Almost arbitrary FrameData, e.g. from file,
+                or a c++ podio::Frame that is moved into this Frame
         """
         # Explicitly check for None here, to not return empty Frames on nullptr data
-        if data is not None:
+        if isinstance(data, podio.Frame):
+            self._frame = podio.Frame(cppyy.gbl.std.move(data))
+        elif data is not None:
             self._frame = podio.Frame(data)
         else:
             self._frame = podio.Frame()
 
-        self._param_key_types = self._get_param_keys_types()
+        # The parameters are only retrieved once they are accessed. They are not
+        # cached once the (mutable) GenericParameters have been handed out
+        self._param_cache = None
+        self._params_shared = False
 
     def getAvailableCollections(self):
         """Get the currently available collection (names) from this Frame.
@@ -125,7 +161,10 @@ class Frame:
             name (str): The name of the desired collection
 
         Returns:
-            collection (podio.CollectionBase): The collection stored in the Frame
+            collection (podio.CollectionBase): The collection stored in the Frame.
+                It offers to_numpy and column methods for zero-copy access to its
+                data as well as to_arrow and to_awkward methods for exporting it
+                (see podio.columnar). The collection keeps the Frame alive
 
         Raises:
             KeyError: If the collection with the name is not available
@@ -133,6 +172,10 @@ class Frame:
         collection = self._frame.get(name)
         if collection == self._coll_nullptr:
             raise KeyError(f"Collection '{name}' is not available")
+        add_columnar_access(type(collection))
+        # The collection and the arrays obtained from it refer to memory owned by
+        # the Frame
+        collection._frame = self  # pylint: disable=protected-access
         return collection
 
     def put(self, collection, name):
@@ -156,7 +199,41 @@ class Frame:
         """
         if not _is_collection_base(collection):
             raise ValueError("Can only put podio collections into a Frame")
-        return self._frame.put(cppyy.gbl.std.move(collection), name)
+        collection = self._frame.put(cppyy.gbl.std.move(collection), name)
+        add_columnar_access(type(collection))
+        # The collection and the arrays obtained from it refer to memory owned by
+        # the Frame
+        collection._frame = self  # pylint: disable=protected-access
+        return collection
+
+    def to_arrow(self, names=None):
+        """Export collections of the Frame to arrow RecordBatches.
+
+        Args:
+            names (list(str), optional): The names of the collections to
+                export. Defaults to all available collections
+
+        Returns:
+            dict(str, pyarrow.RecordBatch): The exported collections by name. See
+                podio.columnar.to_arrow for the layout of the RecordBatches
+        """
+        if names is None:
+            names = self.getAvailableCollections()
+        return {name: to_arrow(self.get(name)) for name in names}
+
+    def to_awkward(self, names=None):
+        """Export collections of the Frame to awkward Arrays.
+
+        Args:
+            names (list(str), optional): The names of the collections to
+                export. Defaults to all available collections
+
+        Returns:
+            dict(str, awkward.Array): The exported collections by name
+        """
+        if names is None:
+            names = self.getAvailableCollections()
+        return {name: to_awkward(self.get(name)) for name in names}
 
     @property
     def parameters(self):
@@ -165,7 +242,7 @@ class Frame:
         Returns:
             tuple (str): The names of the available parameters from this Frame.
         """
-        return tuple(self._param_key_types.keys())
+        return tuple(self._get_params().keys())
 
     def get_parameter(self, name, as_type=None):
         """Get the parameter stored under the given name.
@@ -186,38 +263,36 @@ class Frame:
                 has been passed.
         """
 
-        def _get_param_value(par_type, name):
-            par_value = self._frame.getParameter[par_type](name)
-            if len(par_value) == 1:
-                return par_value[0]
-            return list(par_value)
+        def _get_param_value(par_values):
+            if len(par_values) == 1:
+                return par_values[0]
+            return list(par_values)
 
         # This access already raises the KeyError if there is no such parameter
-        par_type = self._param_key_types[name]
+        par_values = self._get_params()[name]
         # Exactly one parameter, nothing more to do here
-        if len(par_type) == 1:
-            return _get_param_value(par_type[0], name)
+        if len(par_values) == 1:
+            return _get_param_value(next(iter(par_values.values())))
 
         if as_type is None:
             raise ValueError(
-                f"{name} parameter has {len(par_type)} different types available, "
+                f"{name} parameter has {len(par_values)} different types available, "
                 "but no as_type argument to disambiguate"
             )
 
-        # Get all possible c++ vector types and see if we can unambiguously map them
-        # to the available types for this parameter
-        vec_types = _get_cpp_vector_types(as_type)
-        vec_types = [t for t in vec_types if t in par_type]
-        if len(vec_types) == 0:
+        # Get all possible c++ types and see if we can unambiguously map them to
+        # the available types for this parameter
+        cpp_types = [t for t, _ in _get_cpp_types(as_type) if t in par_values]
+        if len(cpp_types) == 0:
             raise ValueError(f"{name} parameter is not available as type {as_type}")
 
-        if len(vec_types) > 1:
+        if len(cpp_types) > 1:
             raise ValueError(
                 f"{name} parameter cannot be unambiguously mapped to a c++ type with "
                 f"{as_type=}. Consider passing in the c++ type instead of the python type"
             )
 
-        return _get_param_value(vec_types[0], name)
+        return _get_param_value(par_values[cpp_types[0]])
 
     def put_parameter(self, key, value, as_type=None):
         """Put a parameter into the Frame.
@@ -269,17 +344,21 @@ class Frame:
             else:
                 self._frame.putParameter(key, value)
 
-        self._param_key_types = self._get_param_keys_types()  # refresh the cache
+        self._param_cache = None  # invalidate the cache
 
     def get_parameters(self):
         """Get the complete podio::GenericParameters object stored in this Frame.
 
         NOTE: This is mainly intended for dumping things, for actually obtaining
-        parameters please use get_parameter
+        parameters please use get_parameter. Since the returned parameters can
+        be modified, parameter access is no longer cached for this Frame
+        afterwards
 
         Returns:
             podio.GenericParameters: The stored generic parameters
         """
+        self._params_shared = True
+        self._param_cache = None
         # Going via the not entirely intended way here
         return self._frame.getParameters()
 
@@ -297,41 +376,30 @@ class Frame:
             KeyError: If no parameter is stored under the given name
         """
         # This raises the KeyError if the name is not present
-        par_types = [
-            t.replace("std::vector<", "").replace(">", "") for t in self._param_key_types[name]
-        ]
-        # Assume that we have one parameter and update the dictionary below in case
-        # there are more
-        par_infos = {t: 1 for t in par_types}
-        for par_type in par_types:
-            par_value = self.get_parameter(name, as_type=par_type)
-            if isinstance(par_value, list):
-                par_infos[par_type] = len(par_value)
-
-        return par_infos
-
-    def _get_param_keys_types(self):
-        """Initialize the param keys dict for easier lookup of the available parameters.
+        return {par_type: len(values) for par_type, values in self._get_params()[name].items()}
+
+    def _get_params(self):
+        """Get all parameters of the Frame, retrieving them in one call on first access.
+
+        The parameters are retrieved again on every access once the
+        GenericParameters have been obtained via get_parameters, since they
+        could have been modified since.
 
         Returns:
-            dict: A dictionary mapping each key to the corresponding c++ type
+            dict: A dictionary mapping each key to a dictionary of the c++ type(s)
+                and the values stored for that type
         """
-        params = self._frame.getParameters()
-        keys_dict = {}
-        for par_type, _ in SUPPORTED_PARAMETER_TYPES:
-            keys = params.getKeys[par_type]()
-            for key in keys:
-                # Make sure to convert to a python string here to not have a dangling
-                # reference here for the key.
-                key = str(key)
-                # In order to support the use case of having the same key for multiple
-                # types create a list of available types for the key, so that we can
-                # disambiguate later. Storing a vector<type> here, and check later how
-                # many elements there actually are to decide whether to return a single
-                # value or a list
-                if key not in keys_dict:
-                    keys_dict[key] = [f"std::vector<{par_type}>"]
-                else:
-                    keys_dict[key].append(f"std::vector<{par_type}>")
-
-        return keys_dict
+        if self._param_cache is not None:
+            return self._param_cache
+
+        # Going through JSON is considerably faster than retrieving the keys
+        # and values for every type separately via cppyy
+        entries = json.loads(str(podio.utils.parametersAsJSON(self._frame.getParameters())))
+        params = {}
+        for key, par_type, values in entries:
+            # The same key can be used for multiple types, disambiguate later
+            params.setdefault(key, {})[par_type] = values
+
+        if not self._params_shared:
+            self._param_cache = params
+        return params
@@ -1,9 +1,25 @@
 #!/usr/bin/env python3
 """Module defining the Frame iterator used by the Reader interface"""
 
+import ROOT
+
 # pylint: disable-next=import-error # gbl is a dynamic module from cppyy
 from cppyy.gbl import std
 from podio.frame import Frame
+from podio.columnar import ak, to_awkward
+
+# NOTE: It is necessary that this can be found on the ROOT_INCLUDE_PATH
+if ROOT.gInterpreter.LoadFile("podio/FramePrefetcher.h") == 0:  # noqa: E402
+    from ROOT import podio  # noqa: E402 # pylint: disable=wrong-import-position
+
+
+def _stack_collections(frames, name):
+    """Stack the collections with the given name from several Frames into one
+    awkward Array with one (variable length) entry per Frame"""
+    arrays = [to_awkward(frame.get(name)) for frame in frames]
+    stacked = ak.unflatten(ak.concatenate(arrays), [len(a) for a in arrays])
+    # Concatenating only one array does not copy, but the Frames will be gone
+    return ak.copy(stacked) if len(arrays) == 1 else stacked
 
 
 class FrameCategoryIterator:
@@ -43,6 +59,20 @@ class FrameCategoryIterator:
         Args:
             entry (int): The entry to access
         """
+        return Frame(std.move(self.read_data(entry)))
+
+    def read_data(self, entry):
+        """Get the raw FrameData of a specific entry, without creating a Frame.
+
+        Args:
+            entry (int): The entry to access
+
+        Returns:
+            FrameData: The data as it has been read by the reader
+
+        Raises:
+            IndexError: If the entry is not available
+        """
         # Handle python negative indexing to start from the end
         if entry < 0:
             entry = self._reader.getEntries(self._category) + entry
@@ -64,6 +94,45 @@ class FrameCategoryIterator:
             raise
 
         if frame_data:
-            return Frame(std.move(frame_data))
+            return frame_data
 
         raise IndexError
+
+    def batches(self, batch_size, prefetch=2, threads=1, collections=None):
+        """Iterate over all Frames in batches that are read in the background.
+
+        The Frames are read and all their collections are unpacked on c++
+        threads, which do not hold the GIL, while the previous batches are
+        processed. The reader must not be used otherwise while iterating.
+
+        Args:
+            batch_size (int): The (maximum) number of Frames per batch
+            prefetch (int, optional): The number of batches that are read ahead
+            threads (int, optional): The number of threads for reading and
+                unpacking. Reading is sequential, unpacking of different batches
+                happens concurrently
+            collections (list(str), optional): If passed, columnar batches are
+                yielded instead of Frames (requires awkward)
+
+        Yields:
+            list(Frame) or dict(str, awkward.Array): The Frames of the batch or,
+                if collections are passed, one awkward Array per collection with
+                one entry per Frame (copied out of the Frames)
+        """
+        if collections is not None and ak is None:
+            raise ImportError("awkward is necessary for columnar batches")
+
+        ROOT.EnableThreadSafety()
+        prefetcher_type = podio.FramePrefetcher[type(self._reader)]
+        prefetcher_type.nextBatch.__release_gil__ = True
+        prefetcher = prefetcher_type(self._reader, self._category, batch_size, prefetch, threads)
+
+        while True:
+            batch = prefetcher.nextBatch()
+            if batch.empty():
+                return
+            frames = [Frame(frame) for frame in batch]
+            if collections is None:
+                yield frames
+            else:
+                yield {name: _stack_collections(frames, name) for name in collections}
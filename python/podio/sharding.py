@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Module for processing the Frames of (several) files in parallel processes.
+
+The entries of a category are split into balanced, contiguous shards, which
+can span file boundaries. Every worker process only opens the files that
+contain the entries of its shard and reads only these entries.
+
+Example:
+    def count_hits(frames):
+        return sum(len(frame.get("hits")) for frame in frames)
+
+    n_hits = process_sharded(count_hits, ["f1.root", "f2.root"], merge=sum)
+
+NOTE: The worker processes are started with the "spawn" method, hence the
+processing function has to be picklable, i.e. defined at module level.
+"""
+
+import multiprocessing
+import os
+from dataclasses import dataclass
+
+from podio.reading import get_reader
+
+
+@dataclass(frozen=True)
+class Shard:
+    """A contiguous range of entries of one category.
+
+    Attributes:
+        category (str): The category of the Frames
+        ranges (tuple(tuple(str, int, int))): The files with the first and one
+            past the last entry of the shard in each of them
+    """
+
+    category: str
+    ranges: tuple
+
+    def __len__(self):
+        """Get the number of entries of this shard."""
+        return sum(end - begin for _, begin, end in self.ranges)
+
+    def frames(self):
+        """Iterate over all Frames of this shard.
+
+        Yields:
+            podio.frame.Frame: The Frames in the order in which they are stored
+        """
+        for filename, begin, end in self.ranges:
+            frames = get_reader(filename).get(self.category)
+            for entry in range(begin, end):
+                yield frames[entry]
+
+
+def make_shards(filenames, category, n_shards, entries=None):
+    """Split the entries of a category into balanced shards.
+
+    Args:
+        filenames (str or list(str)): The input file(s)
+        category (str): The category of the Frames
+        n_shards (int): The (maximum) number of shards. Fewer shards are created
+            if there are less entries than that
+        entries (list(int), optional): The number of entries of the category
+            in each file. Determined by opening every file if not passed
+
+    Returns:
+        list(Shard): The shards, covering all entries in order
+    """
+    if isinstance(filenames, str):
+        filenames = (filenames,)
+    if entries is None:
+        entries = [len(get_reader(f).get(category)) for f in filenames]
+    if len(entries) != len(filenames):
+        raise ValueError("Need the number of entries for every file")
+
+    total = sum(entries)
+    n_shards = max(1, min(n_shards, total))
+    shards = []
+    file_idx, local_entry = 0, 0
+    for i in range(n_shards):
+        # distribute the remainder over the first shards
+        n_entries = total // n_shards + (1 if i < total % n_shards else 0)
+        ranges = []
+        while n_entries > 0:
+            if local_entry >= entries[file_idx]:
+                file_idx, local_entry = file_idx + 1, 0
+                continue
+            end = min(entries[file_idx], local_entry + n_entries)
+            ranges.append((filenames[file_idx], local_entry, end))
+            n_entries -= end - local_entry
+            local_entry = end
+        if ranges:
+            shards.append(Shard(category, tuple(ranges)))
+
+    return shards
+
+
+def _process_shard(func, shard):
+    """Apply the processing function to the Frames of one shard"""
+    return func(shard.frames())
+
+
+# pylint: disable-next=too-many-arguments
+def process_sharded(func, filenames, category="events", n_workers=None, n_shards=None, merge=None):
+    """Process all Frames of a category in parallel worker processes.
+
+    Args:
+        func (callable): The (picklable) function that processes the Frames of
+            one shard. It gets an iterator over these Frames and returns a
+            (picklable) result
+        filenames (str or list(str)): The input file(s)
+        category (str, optional): The category of the Frames
+        n_workers (int, optional): The number of worker processes. Defaults to
+            the number of available cores
+        n_shards (int, optional): The number of shards. Defaults to n_workers.
+            More shards than workers can help balancing unevenly sized Frames
+        merge (callable, optional): A function to merge the list of results
+
+    Returns:
+        The list of results of all shards in the order of the entries, or the
+        return value of merge called with this list
+    """
+    n_workers = n_workers or os.cpu_count() or 1
+    shards = make_shards(filenames, category, n_shards or n_workers)
+    if not shards:
+        return merge([]) if merge is not None else []
+
+    ctx = multiprocessing.get_context("spawn")
+    with ctx.Pool(min(n_workers, len(shards))) as pool:
+        results = pool.starmap(_process_shard, [(func, shard) for shard in shards])
+
+    return merge(results) if merge is not None else results
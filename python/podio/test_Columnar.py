@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Unit tests for the zero-copy columnar access to podio collections"""
+
+import gc
+import unittest
+
+# pylint: disable=import-error
+from ROOT import ExampleHitCollection
+
+from podio.frame import Frame
+from podio.columnar import np, pa, ak, to_numpy, column, to_arrow
+
+# using root_io as that should always be present regardless of which backends are built
+from podio.root_io import Reader
+
+
+@unittest.skipIf(np is None, "numpy is not available")
+class ColumnarAccessTest(unittest.TestCase):
+    """Unit tests for the columnar access to collections read from file.
+
+    NOTE: The assumption is that the Frame has been written by tests/write_frame.h
+    """
+
+    def setUp(self):
+        """Open the file and read the first event"""
+        reader = Reader("root_io/example_frame.root")
+        self.event = reader.get("events")[0]
+
+    def test_data_members(self):
+        """Check that the POD members are accessible as structured array"""
+        hits = self.event.get("hits")
+        data = hits.to_numpy()
+        self.assertEqual(len(data), len(hits))
+        self.assertEqual(list(data["energy"]), [h.energy() for h in hits])
+        self.assertEqual(list(data["cellID"]), [h.cellID() for h in hits])
+        self.assertEqual(list(hits.column("x")), [h.x() for h in hits])
+        self.assertFalse(data.flags.writeable)
+
+        with self.assertRaises(KeyError):
+            _ = hits.column("nonExistantMember")
+
+    def test_vector_members(self):
+        """Check that vector members can be accessed via the begin and end indices"""
+        vecs = self.event.get("WithVectorMember")
+        data = vecs.to_numpy()
+        counts = vecs.column("count")
+        for i, vec in enumerate(vecs):
+            begin, end = data["count_begin"][i], data["count_end"][i]
+            self.assertEqual(list(counts[begin:end]), list(vec.count()))
+
+    def test_relations(self):
+        """Check that the ObjectIDs of relations are accessible"""
+        clusters = self.event.get("clusters")
+        hits = self.event.get("hits")
+        data = clusters.to_numpy()
+        hit_ids = clusters.column("Hits")
+        for i, cluster in enumerate(clusters):
+            ids = hit_ids[data["Hits_begin"][i] : data["Hits_end"][i]]
+            self.assertEqual(list(ids["index"]), [h.getObjectID().index for h in cluster.Hits()])
+            for coll_id in ids["collectionID"]:
+                self.assertEqual(coll_id, hits.getID())
+
+        hit_refs = to_numpy(self.event.get("hitRefs"))
+        self.assertEqual(list(hit_refs["index"]), [1, 0])
+
+    def test_user_data(self):
+        """Check that UserDataCollections are accessible as flat arrays"""
+        user_ints = self.event.get("userInts")
+        self.assertEqual(list(user_ints.to_numpy()), list(user_ints))
+
+    def test_lifetime(self):
+        """Check that the arrays keep the memory they refer to alive"""
+        energies = [h.energy() for h in self.event.get("hits")]
+        data = self.event.get("hits").to_numpy()
+        del self.event
+        gc.collect()
+        self.assertEqual(list(data["energy"]), energies)
+
+    def test_new_collection(self):
+        """Check that collections created in python cannot be accessed, since
+        their buffers do not necessarily reflect their contents"""
+        hits = ExampleHitCollection()
+        for i in range(3):
+            hits.create(i, 0.0, 0.0, 0.0, 1.5 * i)
+        with self.assertRaises(ValueError):
+            _ = column(hits, "energy")
+
+        frame = Frame()
+        hits = frame.put(hits, "hits")
+        with self.assertRaises(ValueError):
+            _ = hits.column("cellID")
+
+
+@unittest.skipIf(pa is None, "pyarrow is not available")
+class ArrowExportTest(unittest.TestCase):
+    """Unit tests for the export of collections to arrow and awkward.
+
+    NOTE: The assumption is that the Frame has been written by tests/write_frame.h
+    """
+
+    def setUp(self):
+        """Open the file and read the first event"""
+        reader = Reader("root_io/example_frame.root")
+        self.event = reader.get("events")[0]
+
+    def test_data_members(self):
+        """Check that the members become columns of the RecordBatch"""
+        hits = self.event.get("hits")
+        batch = hits.to_arrow()
+        self.assertEqual(batch.num_rows, len(hits))
+        self.assertEqual(batch.column("energy").to_pylist(), [h.energy() for h in hits])
+
+    def test_vector_members_and_relations(self):
+        """Check that vector members and relations become list arrays"""
+        vecs = to_arrow(self.event.get("WithVectorMember"))
+        self.assertNotIn("count_begin", vecs.schema.names)
+        self.assertEqual(
+            vecs.column("count").to_pylist(),
+            [list(v.count()) for v in self.event.get("WithVectorMember")],
+        )
+
+        clusters = self.event.get("clusters")
+        hit_ids = clusters.to_arrow().column("Hits").to_pylist()
+        for ids, cluster in zip(hit_ids, clusters):
+            self.assertEqual(
+                [i["index"] for i in ids], [h.getObjectID().index for h in cluster.Hits()]
+            )
+
+    def test_user_data_and_frame(self):
+        """Check the export of user data and of (parts of) a Frame"""
+        user_ints = self.event.get("userInts")
+        self.assertEqual(user_ints.to_arrow().column("values").to_pylist(), list(user_ints))
+
+        batches = self.event.to_arrow(["hits", "hitRefs"])
+        self.assertEqual(set(batches.keys()), {"hits", "hitRefs"})
+        self.assertEqual(batches["hitRefs"].column("index").to_pylist(), [1, 0])
+
+    def test_lifetime(self):
+        """Check that the exported arrays keep the memory they refer to alive"""
+        counts = [list(v.count()) for v in self.event.get("WithVectorMember")]
+        batch = self.event.get("WithVectorMember").to_arrow()
+        del self.event
+        gc.collect()
+        self.assertEqual(batch.column("count").to_pylist(), counts)
+
+    @unittest.skipIf(ak is None, "awkward is not available")
+    def test_awkward(self):
+        """Check that collections can be exported to awkward arrays"""
+        hits = self.event.get("hits")
+        array = hits.to_awkward()
+        self.assertEqual(len(array), len(hits))
+        self.assertEqual(ak.to_list(array["cellID"]), [h.cellID() for h in hits])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -35,12 +35,14 @@ EXPECTED_COLL_NAMES = {
     "emptyCollection",
     "emptySubsetColl",
 }
-# The expected collections from the extension (only present in the other_events category)
+# The expected collections from the extension and the ones that are only
+# written for the other_events category
 EXPECTED_EXTENSION_COLL_NAMES = {
     "extension_Contained",
     "extension_ExternalComponent",
     "extension_ExternalRelation",
     "VectorMemberSubsetColl",
+    "userTable",
 }
 
 # The expected parameter names in each frame
@@ -123,6 +125,19 @@ class FrameTest(unittest.TestCase):
         frame.put_parameter("float_as_float", 3.14, as_type="float")
         self.assertAlmostEqual(frame.get_parameter("float_as_float"), 3.14, places=5)
 
+    def test_frame_modified_parameters(self):
+        """Check that modifications via the GenericParameters are visible"""
+        frame = Frame()
+        frame.put_parameter("an_int", 42)
+        self.assertEqual(frame.get_parameter("an_int"), 42)
+
+        params = frame.get_parameters()
+        self.assertEqual(frame.get_parameter("an_int"), 42)
+        params.setValue["int"]("an_int", 43)
+        params.setValue["int"]("another_int", 1)
+        self.assertEqual(frame.get_parameter("an_int"), 43)
+        self.assertEqual(set(frame.parameters), {"an_int", "another_int"})
+
 
 class FrameReadTest(unittest.TestCase):
     """Unit tests for the Frame python bindings for Frames read from file.
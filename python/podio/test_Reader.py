@@ -70,6 +70,46 @@ class ReaderTestCaseMixin:
             i += 1
         self.assertEqual(i, 0)
 
+    def test_frame_iterator_batches(self):
+        """Check that batched iteration yields all Frames in order"""
+        batches = list(self.reader.get("events").batches(3, prefetch=2, threads=2))
+        self.assertEqual([len(b) for b in batches], [3, 3, 3, 1])
+
+        frames = [frame for batch in batches for frame in batch]
+        for i, frame in enumerate(frames):
+            self.assertEqual(frame.get_parameter("UserEventName"), f" event_number_{i}")
+            self.assertEqual(len(frame.get("hits")), len(self.reader.get("events")[i].get("hits")))
+
+    def test_io_stats(self):
+        """Check that the I/O statistics are recorded once enabled"""
+        self.assertEqual(self.reader.io_stats, {})
+
+        self.reader.enable_io_stats()
+        for frame in self.reader.get("events"):
+            _ = frame.get("hits")
+
+        stats = self.reader.io_stats
+        self.assertEqual(list(stats.keys()), ["events"])
+        self.assertEqual(stats["events"]["frame"]["entries"], 10)
+        self.assertEqual(stats["events"]["collections"]["hits"]["entries"], 10)
+        self.assertGreater(stats["events"]["collections"]["hits"]["prepare_time"], 0)
+
+        self.reader.enable_io_stats(False)
+        self.assertEqual(self.reader.io_stats, {})
+
+    def test_release_io_buffers(self):
+        """Check that collections are intact if their I/O buffers are released"""
+        kept_hits = self.reader.get("events")[0].get("hits")
+        self.reader.release_io_buffers()
+        released_hits = self.reader.get("events")[0].get("hits")
+
+        self.assertEqual(len(released_hits), len(kept_hits))
+        for kept, released in zip(kept_hits, released_hits):
+            self.assertEqual(kept.energy(), released.energy())
+        self.assertLess(
+            released_hits.memoryUsage().ioBuffers, kept_hits.memoryUsage().ioBuffers
+        )
+
 
 class LegacyReaderTestCaseMixin:
     """Common test cases for the legacy readers python bindings.
@@ -103,3 +143,10 @@ class LegacyReaderTestCaseMixin:
         # Index based access
         frame = frames[123]
         self.assertEqual(frame.get_parameter("UserEventName"), " event_number_123")
+
+    def test_unsupported_io_options(self):
+        """Make sure that options that are not supported by the legacy readers raise"""
+        with self.assertRaises(RuntimeError):
+            self.reader.enable_io_stats()
+        with self.assertRaises(RuntimeError):
+            self.reader.release_io_buffers()
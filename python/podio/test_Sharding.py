@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Unit tests for the sharded processing of Frames in several processes"""
+
+import itertools
+import unittest
+
+from podio.sharding import make_shards, process_sharded
+
+# using root_io as that should always be present regardless of which backends are built
+INPUT_FILE = "root_io/example_frame.root"
+
+
+def _event_names(frames):
+    """Get the event names of all frames (module level to be picklable)"""
+    return [frame.get_parameter("UserEventName") for frame in frames]
+
+
+class ShardingTest(unittest.TestCase):
+    """Unit tests for the sharding functionality.
+
+    NOTE: The assumption is that the file has been written by tests/write_frame.h
+    """
+
+    def test_make_shards(self):
+        """Check that shards are balanced and span file boundaries"""
+        shards = make_shards(["a", "b"], "events", 3, entries=[10, 10])
+        self.assertEqual([len(s) for s in shards], [7, 7, 6])
+        self.assertEqual(shards[1].ranges, (("a", 7, 10), ("b", 0, 4)))
+
+        shards = make_shards(["a", "b", "c"], "events", 4, entries=[2, 0, 1])
+        self.assertEqual([len(s) for s in shards], [1, 1, 1])
+        self.assertEqual(shards[2].ranges, (("c", 0, 1),))
+
+        self.assertEqual(make_shards(["a"], "events", 2, entries=[0]), [])
+        with self.assertRaises(ValueError):
+            make_shards(["a", "b"], "events", 2, entries=[1])
+
+    def test_shard_frames(self):
+        """Check that the frames of a shard are read from the right files"""
+        shard = make_shards([INPUT_FILE, INPUT_FILE], "events", 3)[1]
+        names = _event_names(shard.frames())
+        self.assertEqual(
+            names, [f" event_number_{i}" for i in itertools.chain(range(7, 10), range(4))]
+        )
+
+    def test_process_sharded(self):
+        """Check that all frames are processed and results are merged in order"""
+        names = process_sharded(
+            _event_names,
+            [INPUT_FILE, INPUT_FILE],
+            n_workers=2,
+            n_shards=3,
+            merge=lambda res: list(itertools.chain.from_iterable(res)),
+        )
+        self.assertEqual(names, [f" event_number_{i}" for i in range(10)] * 2)
+
+
+if __name__ == "__main__":
+    unittest.main()
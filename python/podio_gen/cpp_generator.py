@@ -314,9 +314,12 @@ class CPPClassGenerator(ClassGeneratorBaseMixin):
                     )
                 includes.add(self._build_include_for_class(relation.bare_type, include_from))
 
-        if datatype["VectorMembers"]:
+        if datatype["VectorMembers"] or datatype["OneToManyRelations"]:
             includes_cc.add("#include <numeric>")
 
+        # Necessary for writing subset collections, relations and vector members
+        includes_cc.add("#include <algorithm>")
+
         datatype["includes_coll_cc"] = self._sort_includes(includes_cc)
         datatype["includes_coll_data"] = self._sort_includes(includes)
 
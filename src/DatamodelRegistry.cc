@@ -71,6 +71,11 @@ RelationNames DatamodelRegistry::getRelationNames(std::string_view typeName) con
   if (typeName.substr(0, 24) == "podio::UserDataCollection") {
     return {emptyVec, emptyVec};
   }
+  // The column names of a UserDataTable are stored like a vector member
+  if (typeName.substr(0, 20) == "podio::UserDataTable") {
+    static std::vector<std::string_view> columnNamesVec{"columnNames"};
+    return {emptyVec, columnNamesVec};
+  }
 
   // Strip Collection if necessary
   if (typeName.size() > 10 && typeName.substr(typeName.size() - 10) == "Collection") {
@@ -46,4 +46,20 @@ std::vector<std::string> DatamodelDefinitionHolder::getAvailableDatamodels() con
   return defs;
 }
 
+bool mergeDatamodelDefinitions(DatamodelDefinitionHolder::MapType& definitions,
+                               const DatamodelDefinitionHolder::MapType& toMerge) {
+  bool consistent = true;
+  for (const auto& [name, definition] : toMerge) {
+    const auto it = std::find_if(definitions.cbegin(), definitions.cend(),
+                                 [&name = name](const auto& entry) { return std::get<0>(entry) == name; });
+    if (it == definitions.cend()) {
+      definitions.emplace_back(name, definition);
+    } else if (std::get<1>(*it) != definition) {
+      consistent = false;
+    }
+  }
+
+  return consistent;
+}
+
 } // namespace podio
@@ -0,0 +1,100 @@
+#include "podio/IOStats.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace podio {
+
+CollectionIOStats& CollectionIOStats::operator+=(const CollectionIOStats& other) {
+  nEntries += other.nEntries;
+  compressedBytes += other.compressedBytes;
+  uncompressedBytes += other.uncompressedBytes;
+  compressionTime += other.compressionTime;
+  serializationTime += other.serializationTime;
+  prepareTime += other.prepareTime;
+  setReferencesTime += other.setReferencesTime;
+  return *this;
+}
+
+CollectionIOStats CategoryIOStats::total() const {
+  auto sum = frame;
+  for (const auto& [_, stats] : collections) {
+    sum += stats;
+  }
+  return sum;
+}
+
+void IOStats::addFrame(const std::string& category, const CollectionIOStats& frameStats,
+                       const std::vector<std::pair<std::string, CollectionIOStats>>& collStats) {
+  std::lock_guard lock{m_mutex};
+  auto& catStats = m_stats[category];
+  catStats.frame += frameStats;
+  for (const auto& [name, stats] : collStats) {
+    catStats.collections[name] += stats;
+  }
+}
+
+void IOStats::add(const std::string& category, const std::string& collection, const CollectionIOStats& stats) {
+  std::lock_guard lock{m_mutex};
+  m_stats[category].collections[collection] += stats;
+}
+
+std::map<std::string, CategoryIOStats> IOStats::get() const {
+  std::lock_guard lock{m_mutex};
+  return m_stats;
+}
+
+CategoryIOStats IOStats::get(const std::string& category) const {
+  std::lock_guard lock{m_mutex};
+  if (const auto it = m_stats.find(category); it != m_stats.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+void IOStats::reset() {
+  std::lock_guard lock{m_mutex};
+  m_stats.clear();
+}
+
+namespace {
+  void printRow(std::ostream& os, const std::string& name, const CollectionIOStats& stats, size_t nameWidth) {
+    const auto toMs = [](CollectionIOStats::Duration duration) {
+      return std::chrono::duration<double, std::milli>(duration).count();
+    };
+    os << std::left << std::setw(nameWidth) << name << std::right << std::setw(10) << stats.nEntries
+       << std::setw(14) << stats.compressedBytes << std::setw(14) << stats.uncompressedBytes << std::fixed
+       << std::setprecision(3) << std::setw(14) << toMs(stats.compressionTime) << std::setw(14)
+       << toMs(stats.serializationTime) << std::setw(14) << toMs(stats.prepareTime) << std::setw(14)
+       << toMs(stats.setReferencesTime) << '\n';
+  }
+} // namespace
+
+void IOStats::print(std::ostream& os) const {
+  const auto stats = get();
+  const auto flags = os.flags();
+  const auto precision = os.precision();
+
+  for (const auto& [category, catStats] : stats) {
+    size_t nameWidth = 12;
+    for (const auto& [name, _] : catStats.collections) {
+      nameWidth = std::max(nameWidth, name.size() + 2);
+    }
+
+    os << "Category '" << category << "' (" << catStats.frame.nEntries << " Frames)\n";
+    os << std::left << std::setw(nameWidth) << "Name" << std::right << std::setw(10) << "Entries" << std::setw(14)
+       << "Comp. [B]" << std::setw(14) << "Uncomp. [B]" << std::setw(14) << "Compr. [ms]" << std::setw(14)
+       << "Serial. [ms]" << std::setw(14) << "Prepare [ms]" << std::setw(14) << "SetRefs [ms]" << '\n';
+    printRow(os, "<Frame>", catStats.frame, nameWidth);
+    for (const auto& [name, collStats] : catStats.collections) {
+      printRow(os, name, collStats, nameWidth);
+    }
+    printRow(os, "<Total>", catStats.total(), nameWidth);
+    os << '\n';
+  }
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+} // namespace podio
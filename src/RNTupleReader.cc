@@ -5,6 +5,7 @@
 #include "podio/CollectionIDTable.h"
 #include "podio/DatamodelRegistry.h"
 #include "podio/GenericParameters.h"
+#include "podio/Tracing.h"
 #include "rootUtils.h"
 
 #include <ROOT/RError.hxx>
@@ -122,6 +123,7 @@ std::unique_ptr<ROOTFrameData> RNTupleReader::readNextEntry(const std::string& n
 }
 
 std::unique_ptr<ROOTFrameData> RNTupleReader::readEntry(const std::string& category, const unsigned entNum) {
+  const auto span = TraceSpan("RNTupleReader::readEntry", "io", category);
   if (m_totalEntries.find(category) == m_totalEntries.end()) {
     getEntries(category);
   }
@@ -181,11 +183,27 @@ std::unique_ptr<ROOTFrameData> RNTupleReader::readEntry(const std::string& categ
     buffers.emplace(m_collectionInfo[category].name[i], std::move(collBuffers));
   }
 
+  const auto start = IOStatsRecorder::Clock::now();
   m_readers[category][0]->LoadEntry(entNum);
 
   auto parameters = readEventMetaData(category, entNum);
 
-  return std::make_unique<ROOTFrameData>(std::move(buffers), m_idTables[category], std::move(parameters));
+  auto ioStats = m_ioStats ? IOStatsRecorder(m_ioStats, category) : IOStatsRecorder{};
+  if (ioStats) {
+    auto frameStats = CollectionIOStats{};
+    frameStats.nEntries = 1;
+    frameStats.serializationTime = IOStatsRecorder::elapsedSince(start);
+    auto collStats = std::vector<std::pair<std::string, CollectionIOStats>>{};
+    collStats.reserve(m_collectionInfo[category].name.size());
+    for (const auto& name : m_collectionInfo[category].name) {
+      collStats.emplace_back(name, CollectionIOStats{});
+      collStats.back().second.nEntries = 1;
+    }
+    ioStats.addFrame(frameStats, collStats);
+  }
+
+  return std::make_unique<ROOTFrameData>(std::move(buffers), m_idTables[category], std::move(parameters),
+                                         std::move(ioStats), m_bufferPolicy);
 }
 
 } // namespace podio
@@ -3,6 +3,7 @@
 #include "podio/DatamodelRegistry.h"
 #include "podio/GenericParameters.h"
 #include "podio/SchemaEvolution.h"
+#include "podio/Tracing.h"
 #include "podio/podioVersion.h"
 #include "rootUtils.h"
 
@@ -15,9 +16,10 @@
 
 namespace podio {
 
-RNTupleWriter::RNTupleWriter(const std::string& filename) :
+RNTupleWriter::RNTupleWriter(const std::string& filename, int compressionSettings) :
     m_metadata(ROOT::Experimental::RNTupleModel::Create()),
     m_file(new TFile(filename.c_str(), "RECREATE", "data file")) {
+  m_writeOptions.SetCompression(compressionSettings);
 }
 
 RNTupleWriter::~RNTupleWriter() {
@@ -64,6 +66,7 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& cat
 
 void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& category,
                                const std::vector<std::string>& collsToWrite) {
+  const auto span = TraceSpan("RNTupleWriter::writeFrame", "io", category);
   auto& catInfo = getCategoryInfo(category);
 
   // Use the writer as proxy to check whether this category has been initialized
@@ -76,10 +79,17 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& cat
 
   std::vector<StoreCollection> collections;
   collections.reserve(catInfo.name.size());
+  std::vector<std::pair<std::string, CollectionIOStats>> collStats;
   // Only loop over the collections that were requested in the first Frame of
   // this category
   for (const auto& name : catInfo.name) {
+    const auto start = IOStatsRecorder::Clock::now();
     auto* coll = frame.getCollectionForWrite(name);
+    if (m_ioStats) {
+      collStats.emplace_back(name, CollectionIOStats{});
+      collStats.back().second.nEntries = 1;
+      collStats.back().second.prepareTime = IOStatsRecorder::elapsedSince(start);
+    }
     if (!coll) {
       // Make sure all collections that we want to write are actually available
       // NOLINTNEXTLINE(performance-inefficient-string-concatenation)
@@ -92,7 +102,8 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& cat
   if (new_category) {
     // Now we have enough info to populate the rest
     auto model = createModels(collections);
-    catInfo.writer = ROOT::Experimental::RNTupleWriter::Append(std::move(model), category, *m_file.get(), {});
+    catInfo.writer =
+        ROOT::Experimental::RNTupleWriter::Append(std::move(model), category, *m_file.get(), m_writeOptions);
 
     for (const auto& [name, coll] : collections) {
       catInfo.id.emplace_back(coll->getID());
@@ -109,9 +120,6 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& cat
 
   auto entry = m_categories[category].writer->GetModel()->CreateBareEntry();
 
-  ROOT::Experimental::RNTupleWriteOptions options;
-  options.SetCompression(ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose);
-
   for (const auto& [name, coll] : collections) {
     auto collBuffers = coll->getBuffers();
     if (collBuffers.vecPtr) {
@@ -157,7 +165,18 @@ void RNTupleWriter::writeFrame(const podio::Frame& frame, const std::string& cat
   fillParams<double>(params, entry.get());
   fillParams<std::string>(params, entry.get());
 
-  m_categories[category].writer->Fill(*entry);
+  const auto start = IOStatsRecorder::Clock::now();
+  {
+    // RNTuple serializes and compresses while filling
+    const auto fillSpan = TraceSpan("RNTupleWriter::Fill", "io", category);
+    m_categories[category].writer->Fill(*entry);
+  }
+  if (m_ioStats) {
+    auto frameStats = CollectionIOStats{};
+    frameStats.nEntries = 1;
+    frameStats.serializationTime = IOStatsRecorder::elapsedSince(start);
+    m_ioStats->addFrame(category, frameStats, collStats);
+  }
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleModel>
@@ -277,8 +296,8 @@ void RNTupleWriter::finish() {
   }
 
   m_metadata->Freeze();
-  m_metadataWriter =
-      ROOT::Experimental::RNTupleWriter::Append(std::move(m_metadata), root_utils::metaTreeName, *m_file, {});
+  m_metadataWriter = ROOT::Experimental::RNTupleWriter::Append(std::move(m_metadata), root_utils::metaTreeName,
+                                                               *m_file, m_writeOptions);
 
   m_metadataWriter->Fill();
 
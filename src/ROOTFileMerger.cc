@@ -0,0 +1,211 @@
+#include "podio/ROOTFileMerger.h"
+#include "podio/CollectionIDTable.h"
+#include "podio/Frame.h"
+#include "podio/ROOTReader.h"
+#include "podio/ROOTWriter.h"
+#include "podio/podioVersion.h"
+#include "podio/utilities/DatamodelRegistryIOHelpers.h"
+
+#include "rootUtils.h"
+
+#include "TFile.h"
+#include "TTree.h"
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+namespace podio {
+
+namespace {
+  /// The contents of one category as they are stored in the podio_metadata
+  struct CategoryLayout {
+    std::unique_ptr<podio::CollectionIDTable> idTable{nullptr};
+    std::vector<root_utils::CollectionInfoT> collInfo{};
+
+    bool operator==(const CategoryLayout& other) const {
+      return idTable->names() == other.idTable->names() && idTable->ids() == other.idTable->ids() &&
+          collInfo == other.collInfo;
+    }
+  };
+
+  /// The podio_metadata of one file
+  struct FileMetadata {
+    podio::version::Version version{0, 0, 0};
+    std::map<std::string, CategoryLayout> categories{};
+    DatamodelDefinitionHolder::MapType edmDefinitions{};
+  };
+
+  std::unique_ptr<TFile> openInputFile(const std::string& filename) {
+    auto file = std::unique_ptr<TFile>(TFile::Open(filename.c_str(), "READ"));
+    if (!file || file->IsZombie()) {
+      throw std::runtime_error("File " + filename + " couldn't be opened");
+    }
+    return file;
+  }
+
+  template <typename T>
+  void readMetaBranch(TTree* metaTree, const std::string& name, T*& value) {
+    if (auto* branch = root_utils::getBranch(metaTree, name.c_str())) {
+      branch->SetAddress(&value);
+      branch->GetEntry(0);
+      branch->ResetAddress();
+    }
+  }
+
+  FileMetadata readMetadata(TFile& file, const std::string& filename) {
+    auto* metaTree = file.Get<TTree>(root_utils::metaTreeName);
+    if (!metaTree) {
+      throw std::runtime_error("File " + filename + " has no \"" + root_utils::metaTreeName + "\" tree");
+    }
+
+    FileMetadata metadata{};
+    auto* version = &metadata.version;
+    readMetaBranch(metaTree, root_utils::versionBranchName, version);
+
+    auto* edmDefinitions = &metadata.edmDefinitions;
+    readMetaBranch(metaTree, root_utils::edmDefBranchName, edmDefinitions);
+
+    auto* branches = metaTree->GetListOfBranches();
+    for (int i = 0; i < branches->GetEntries(); ++i) {
+      const std::string name = branches->At(i)->GetName();
+      const auto fUnder = name.find("___");
+      if (fUnder == std::string::npos) {
+        continue;
+      }
+      const auto category = name.substr(0, fUnder);
+      auto [it, inserted] = metadata.categories.try_emplace(category);
+      if (!inserted) {
+        continue;
+      }
+
+      auto& layout = it->second;
+      layout.idTable = std::make_unique<podio::CollectionIDTable>();
+      auto* idTable = layout.idTable.get();
+      readMetaBranch(metaTree, root_utils::idTableName(category), idTable);
+      // The collection info of older files has a different layout, but these
+      // files are never fast cloned anyway
+      if (metadata.version >= podio::version::Version{0, 16, 99}) {
+        auto* collInfo = &layout.collInfo;
+        readMetaBranch(metaTree, root_utils::collInfoName(category), collInfo);
+      }
+    }
+
+    return metadata;
+  }
+
+  /// Fast cloning is only possible if all categories have the same contents
+  /// in all files
+  bool haveSameLayout(const std::vector<FileMetadata>& metadata) {
+    const auto& first = metadata.front();
+    if (first.version < podio::version::Version{0, 16, 99}) {
+      return false;
+    }
+
+    for (const auto& other : metadata) {
+      if (other.version != first.version || other.categories.size() != first.categories.size()) {
+        return false;
+      }
+      for (const auto& [category, layout] : first.categories) {
+        const auto it = other.categories.find(category);
+        if (it == other.categories.end() || !(it->second == layout)) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  void fastCloneFiles(const std::vector<std::string>& inputFiles, const std::string& outputFile,
+                      std::vector<FileMetadata>& metadata) {
+    auto outFile = std::make_unique<TFile>(outputFile.c_str(), "recreate");
+
+    auto& firstMetadata = metadata.front();
+    std::map<std::string, TTree*> outTrees;
+    for (const auto& filename : inputFiles) {
+      const auto inFile = openInputFile(filename);
+      for (const auto& [category, _] : firstMetadata.categories) {
+        auto* inTree = inFile->Get<TTree>(category.c_str());
+        if (!inTree) {
+          throw std::runtime_error("File " + filename + " has no tree for category '" + category + "'");
+        }
+
+        auto& outTree = outTrees[category];
+        if (!outTree) {
+          outFile->cd();
+          outTree = inTree->CloneTree(0);
+          outTree->SetDirectory(outFile.get());
+        }
+        // Copies the compressed baskets without unzipping and unstreaming them
+        if (outTree->CopyEntries(inTree, -1, "fast") < 0) {
+          throw std::runtime_error("Could not copy the entries of category '" + category + "' from file " +
+                                   filename);
+        }
+      }
+    }
+
+    auto edmDefinitions = DatamodelDefinitionHolder::MapType{};
+    for (const auto& fileMetadata : metadata) {
+      if (!mergeDatamodelDefinitions(edmDefinitions, fileMetadata.edmDefinitions)) {
+        std::cerr << "PODIO WARNING: The input files have different definitions for the same EDM. "
+                     "Only the first one is kept"
+                  << std::endl;
+      }
+    }
+
+    auto* metaTree = new TTree(root_utils::metaTreeName, "metadata tree for podio I/O functionality");
+    metaTree->SetDirectory(outFile.get());
+    for (auto& [category, layout] : firstMetadata.categories) {
+      metaTree->Branch(root_utils::idTableName(category).c_str(), layout.idTable.get());
+      metaTree->Branch(root_utils::collInfoName(category).c_str(), &layout.collInfo);
+    }
+    metaTree->Branch(root_utils::versionBranchName, &firstMetadata.version);
+    metaTree->Branch(root_utils::edmDefBranchName, &edmDefinitions);
+    metaTree->Fill();
+
+    outFile->Write();
+    outFile->Close();
+  }
+
+  /// Read all Frames of all files and write them again. Every file is read with
+  /// a dedicated reader, since the podio_metadata can differ between them
+  void rewriteFrames(const std::vector<std::string>& inputFiles, const std::string& outputFile) {
+    podio::ROOTWriter writer(outputFile);
+    for (const auto& filename : inputFiles) {
+      podio::ROOTReader reader{};
+      reader.openFile(filename);
+      for (const auto& cat : reader.getAvailableCategories()) {
+        const auto category = std::string(cat);
+        for (unsigned i = 0; i < reader.getEntries(category); ++i) {
+          writer.writeFrame(podio::Frame(reader.readEntry(category, i)), category);
+        }
+      }
+    }
+    writer.finish();
+  }
+} // namespace
+
+bool mergeROOTFiles(const std::vector<std::string>& inputFiles, const std::string& outputFile, bool fastClone) {
+  if (inputFiles.empty()) {
+    throw std::runtime_error("No input files to merge");
+  }
+
+  std::vector<FileMetadata> metadata;
+  metadata.reserve(inputFiles.size());
+  for (const auto& filename : inputFiles) {
+    const auto file = openInputFile(filename);
+    metadata.emplace_back(readMetadata(*file, filename));
+  }
+
+  if (fastClone && haveSameLayout(metadata)) {
+    fastCloneFiles(inputFiles, outputFile, metadata);
+    return true;
+  }
+
+  rewriteFrames(inputFiles, outputFile);
+  return false;
+}
+
+} // namespace podio
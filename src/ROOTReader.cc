@@ -5,6 +5,7 @@
 #include "podio/CollectionIDTable.h"
 #include "podio/DatamodelRegistry.h"
 #include "podio/GenericParameters.h"
+#include "podio/Tracing.h"
 #include "rootUtils.h"
 
 // ROOT specific includes
@@ -28,7 +29,7 @@ createCollectionBranchesIndexBased(TChain* chain, const podio::CollectionIDTable
                                    const std::vector<root_utils::CollectionInfoT>& collInfo);
 
 GenericParameters ROOTReader::readEntryParameters(ROOTReader::CategoryInfo& catInfo, bool reloadBranches,
-                                                  unsigned int localEntry) {
+                                                  unsigned int localEntry, podio::CollectionIOStats* stats) {
   // Parameter branch is always the last one
   auto& paramBranches = catInfo.branches.back();
 
@@ -42,22 +43,30 @@ GenericParameters ROOTReader::readEntryParameters(ROOTReader::CategoryInfo& catI
   GenericParameters params;
   auto* emd = &params;
   branch->SetAddress(&emd);
-  branch->GetEntry(localEntry);
+  if (stats) {
+    const auto start = IOStatsRecorder::Clock::now();
+    stats->uncompressedBytes += branch->GetEntry(localEntry);
+    stats->serializationTime += IOStatsRecorder::elapsedSince(start);
+  } else {
+    branch->GetEntry(localEntry);
+  }
   return params;
 }
 
 std::unique_ptr<ROOTFrameData> ROOTReader::readNextEntry(const std::string& name) {
   auto& catInfo = getCategoryInfo(name);
-  return readEntry(catInfo);
+  return readEntry(catInfo, name);
 }
 
 std::unique_ptr<ROOTFrameData> ROOTReader::readEntry(const std::string& name, const unsigned entNum) {
   auto& catInfo = getCategoryInfo(name);
   catInfo.entry = entNum;
-  return readEntry(catInfo);
+  return readEntry(catInfo, name);
 }
 
-std::unique_ptr<ROOTFrameData> ROOTReader::readEntry(ROOTReader::CategoryInfo& catInfo) {
+std::unique_ptr<ROOTFrameData> ROOTReader::readEntry(ROOTReader::CategoryInfo& catInfo,
+                                                     const std::string& category) {
+  const auto span = TraceSpan("ROOTReader::readEntry", "io", category);
   if (!catInfo.chain) {
     return nullptr;
   }
@@ -75,19 +84,37 @@ std::unique_ptr<ROOTFrameData> ROOTReader::readEntry(ROOTReader::CategoryInfo& c
   // Also need to make sure to handle the first event
   const auto reloadBranches = treeChange || localEntry == 0;
 
+  auto collStats = std::vector<std::pair<std::string, CollectionIOStats>>{};
+  if (m_ioStats) {
+    collStats.reserve(catInfo.storedClasses.size());
+  }
+
   ROOTFrameData::BufferMap buffers;
   for (size_t i = 0; i < catInfo.storedClasses.size(); ++i) {
-    buffers.emplace(catInfo.storedClasses[i].first, getCollectionBuffers(catInfo, i, reloadBranches, localEntry));
+    const auto& name = catInfo.storedClasses[i].first;
+    auto* stats = m_ioStats ? &collStats.emplace_back(name, CollectionIOStats{}).second : nullptr;
+    buffers.emplace(name, getCollectionBuffers(catInfo, i, reloadBranches, localEntry, stats));
   }
 
-  auto parameters = readEntryParameters(catInfo, reloadBranches, localEntry);
+  auto frameStats = CollectionIOStats{};
+  auto parameters = readEntryParameters(catInfo, reloadBranches, localEntry, m_ioStats ? &frameStats : nullptr);
 
   catInfo.entry++;
-  return std::make_unique<ROOTFrameData>(std::move(buffers), catInfo.table, std::move(parameters));
+  if (!m_ioStats) {
+    return std::make_unique<ROOTFrameData>(std::move(buffers), catInfo.table, std::move(parameters),
+                                           IOStatsRecorder{}, m_bufferPolicy);
+  }
+
+  auto ioStats = IOStatsRecorder(m_ioStats, category);
+  frameStats.nEntries = 1;
+  ioStats.addFrame(frameStats, collStats);
+  return std::make_unique<ROOTFrameData>(std::move(buffers), catInfo.table, std::move(parameters), std::move(ioStats),
+                                         m_bufferPolicy);
 }
 
 podio::CollectionReadBuffers ROOTReader::getCollectionBuffers(ROOTReader::CategoryInfo& catInfo, size_t iColl,
-                                                              bool reloadBranches, unsigned int localEntry) {
+                                                              bool reloadBranches, unsigned int localEntry,
+                                                              podio::CollectionIOStats* stats) {
   const auto& name = catInfo.storedClasses[iColl].first;
   const auto& [collType, isSubsetColl, schemaVersion, index] = catInfo.storedClasses[iColl].second;
   auto& branches = catInfo.branches[index];
@@ -104,7 +131,14 @@ podio::CollectionReadBuffers ROOTReader::getCollectionBuffers(ROOTReader::Catego
 
   // set the addresses and read the data
   root_utils::setCollectionAddresses(collBuffers, branches);
-  root_utils::readBranchesData(branches, localEntry);
+  if (stats) {
+    const auto start = IOStatsRecorder::Clock::now();
+    root_utils::readBranchesData(branches, localEntry, *stats);
+    stats->serializationTime += IOStatsRecorder::elapsedSince(start);
+    stats->nEntries++;
+  } else {
+    root_utils::readBranchesData(branches, localEntry);
+  }
 
   collBuffers.recast(collBuffers);
 
@@ -3,6 +3,7 @@
 #include "podio/DatamodelRegistry.h"
 #include "podio/Frame.h"
 #include "podio/GenericParameters.h"
+#include "podio/Tracing.h"
 #include "podio/podioVersion.h"
 
 #include "rootUtils.h"
@@ -11,8 +12,8 @@
 
 namespace podio {
 
-ROOTWriter::ROOTWriter(const std::string& filename) {
-  m_file = std::make_unique<TFile>(filename.c_str(), "recreate");
+ROOTWriter::ROOTWriter(const std::string& filename, int compressionSettings) {
+  m_file = std::make_unique<TFile>(filename.c_str(), "recreate", "", compressionSettings);
 }
 
 ROOTWriter::~ROOTWriter() {
@@ -27,6 +28,7 @@ void ROOTWriter::writeFrame(const podio::Frame& frame, const std::string& catego
 
 void ROOTWriter::writeFrame(const podio::Frame& frame, const std::string& category,
                             const std::vector<std::string>& collsToWrite) {
+  const auto span = TraceSpan("ROOTWriter::writeFrame", "io", category);
   auto& catInfo = getCategoryInfo(category);
   // Use the TTree as proxy here to decide whether this category has already
   // been initialized
@@ -37,10 +39,17 @@ void ROOTWriter::writeFrame(const podio::Frame& frame, const std::string& catego
     catInfo.tree->SetDirectory(m_file.get());
   }
 
+  auto collStats = std::vector<std::pair<std::string, CollectionIOStats>>{};
   std::vector<StoreCollection> collections;
   collections.reserve(catInfo.collsToWrite.size());
   for (const auto& name : catInfo.collsToWrite) {
+    const auto start = IOStatsRecorder::Clock::now();
     auto* coll = frame.getCollectionForWrite(name);
+    if (m_ioStats) {
+      collStats.emplace_back(name, CollectionIOStats{});
+      collStats.back().second.nEntries = 1;
+      collStats.back().second.prepareTime = IOStatsRecorder::elapsedSince(start);
+    }
     if (!coll) {
       // Make sure all collections that we want to write are actually available
       // NOLINTNEXTLINE(performance-inefficient-string-concatenation)
@@ -64,7 +73,18 @@ void ROOTWriter::writeFrame(const podio::Frame& frame, const std::string& catego
     resetBranches(catInfo.branches, collections, &const_cast<podio::GenericParameters&>(frame.getParameters()));
   }
 
-  catInfo.tree->Fill();
+  const auto start = IOStatsRecorder::Clock::now();
+  {
+    // ROOT serializes and compresses while filling
+    const auto fillSpan = TraceSpan("TTree::Fill", "io", category);
+    catInfo.tree->Fill();
+  }
+  if (m_ioStats) {
+    auto frameStats = CollectionIOStats{};
+    frameStats.nEntries = 1;
+    frameStats.serializationTime = IOStatsRecorder::elapsedSince(start);
+    m_ioStats->addFrame(category, frameStats, collStats);
+  }
 }
 
 ROOTWriter::CategoryInfo& ROOTWriter::getCategoryInfo(const std::string& category) {
@@ -161,11 +181,45 @@ void ROOTWriter::finish() {
   metaTree->Fill();
 
   m_file->Write();
+  if (m_ioStats) {
+    recordBytes();
+  }
   m_file->Close();
 
   m_finished = true;
 }
 
+void ROOTWriter::recordBytes() {
+  const auto addBytes = [](const TBranch* branch, CollectionIOStats& stats) {
+    stats.compressedBytes += branch->GetZipBytes("*");
+    stats.uncompressedBytes += branch->GetTotBytes("*");
+  };
+
+  // The branches of the collections are in the same order as the collections
+  // and the parameters are always in the last branch
+  for (const auto& [category, info] : m_categories) {
+    for (size_t i = 0; i < info.branches.size(); ++i) {
+      const auto& branches = info.branches[i];
+      auto stats = CollectionIOStats{};
+      if (branches.data) {
+        addBytes(branches.data, stats);
+      }
+      for (const auto* branch : branches.refs) {
+        addBytes(branch, stats);
+      }
+      for (const auto* branch : branches.vecs) {
+        addBytes(branch, stats);
+      }
+
+      if (i < info.collsToWrite.size()) {
+        m_ioStats->add(category, info.collsToWrite[i], stats);
+      } else {
+        m_ioStats->addFrame(category, stats);
+      }
+    }
+  }
+}
+
 std::tuple<std::vector<std::string>, std::vector<std::string>>
 ROOTWriter::checkConsistency(const std::vector<std::string>& collsToWrite, const std::string& category) const {
   if (const auto it = m_categories.find(category); it != m_categories.end()) {
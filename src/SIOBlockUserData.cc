@@ -15,4 +15,17 @@ static SIOBlockUserData<uint16_t> _defaultuint16_tCollcetionSIOBlock;
 static SIOBlockUserData<uint32_t> _defaultuint32_tCollcetionSIOBlock;
 static SIOBlockUserData<uint64_t> _defaultuint64_tCollcetionSIOBlock;
 
+static SIOBlockUserDataTable<float> _defaultfloatTableSIOBlock;
+static SIOBlockUserDataTable<double> _defaultdoubleTableSIOBlock;
+
+static SIOBlockUserDataTable<int8_t> _defaultint8_tTableSIOBlock;
+static SIOBlockUserDataTable<int16_t> _defaultint16_tTableSIOBlock;
+static SIOBlockUserDataTable<int32_t> _defaultint32_tTableSIOBlock;
+static SIOBlockUserDataTable<int64_t> _defaultint64_tTableSIOBlock;
+
+static SIOBlockUserDataTable<uint8_t> _defaultuint8_tTableSIOBlock;
+static SIOBlockUserDataTable<uint16_t> _defaultuint16_tTableSIOBlock;
+static SIOBlockUserDataTable<uint32_t> _defaultuint32_tTableSIOBlock;
+static SIOBlockUserDataTable<uint64_t> _defaultuint64_tTableSIOBlock;
+
 } // namespace podio
@@ -0,0 +1,157 @@
+#include "podio/SIOFileMerger.h"
+#include "podio/SIOBlock.h"
+#include "podio/podioVersion.h"
+#include "podio/utilities/DatamodelRegistryIOHelpers.h"
+
+#include "sioUtils.h"
+
+#include <sio/api.h>
+#include <sio/definitions.h>
+
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace podio {
+
+namespace {
+  /// Read the table of contents of a file and position the stream at the start
+  /// of the file again
+  SIOFileTOCRecord readFileTOCRecord(sio::ifstream& stream, const std::string& filename) {
+    stream.seekg(-sio_helpers::SIOTocInfoSize, std::ios_base::end);
+    uint64_t firstWords{0};
+    stream.read(reinterpret_cast<char*>(&firstWords), sizeof(firstWords));
+
+    const uint32_t marker = (firstWords >> 32) & 0xffffffff;
+    if (marker != sio_helpers::SIOTocMarker) {
+      throw std::runtime_error("File " + filename + " has no table of contents");
+    }
+
+    const uint32_t position = firstWords & 0xffffffff;
+    stream.seekg(position);
+    const auto& [uncBuffer, _] = sio_utils::readRecord(stream);
+
+    SIOFileTOCRecord tocRecord{};
+    sio::block_list blocks;
+    blocks.emplace_back(std::make_shared<SIOFileTOCRecordBlock>(&tocRecord));
+    sio::api::read_blocks(uncBuffer.span(), blocks);
+
+    stream.seekg(0);
+    return tocRecord;
+  }
+
+  podio::version::Version readPodioHeader(sio::ifstream& stream) {
+    const auto& [buffer, _] = sio_utils::readRecord(stream, false, sizeof(podio::version::Version));
+
+    sio::block_list blocks;
+    blocks.emplace_back(std::make_shared<SIOVersionBlock>());
+    sio::api::read_blocks(buffer.span(), blocks);
+
+    return static_cast<SIOVersionBlock*>(blocks[0].get())->version;
+  }
+
+  DatamodelDefinitionHolder::MapType readEDMDefinitions(sio::ifstream& stream, SIOFileTOCRecord::PositionType pos) {
+    stream.seekg(pos);
+    const auto& [buffer, _] = sio_utils::readRecord(stream);
+
+    auto mapBlock = std::make_shared<podio::SIOMapBlock<std::string, std::string>>();
+    sio::block_list blocks;
+    blocks.emplace_back(mapBlock);
+    sio::api::read_blocks(buffer.span(), blocks);
+
+    return std::move(mapBlock->mapData);
+  }
+
+  /// Copy the record at the current position of the input stream to the output
+  /// without decompressing it and return its position in the output file
+  SIOFileTOCRecord::PositionType copyRecord(sio::ifstream& inStream, sio::ofstream& outStream) {
+    sio::record_info recInfo;
+    sio::buffer infoBuffer{sio::max_record_info_len};
+    sio::buffer recBuffer{sio::mbyte};
+    sio::api::read_record_info(inStream, recInfo, infoBuffer);
+    sio::api::read_record_data(inStream, recInfo, recBuffer);
+
+    sio::api::write_record(outStream, infoBuffer.span(0, recInfo._header_length),
+                           recBuffer.span(0, recInfo._data_length), recInfo);
+
+    const auto startPos = static_cast<std::streamoff>(recInfo._file_start);
+    if (startPos > std::numeric_limits<SIOFileTOCRecord::PositionType>::max()) {
+      throw std::runtime_error("Merged file is too large to store all record positions in its table of contents");
+    }
+    return static_cast<SIOFileTOCRecord::PositionType>(startPos);
+  }
+} // namespace
+
+void mergeSIOFiles(const std::vector<std::string>& inputFiles, const std::string& outputFile) {
+  if (inputFiles.empty()) {
+    throw std::runtime_error("No input files to merge");
+  }
+
+  sio::ofstream outStream;
+  outStream.open(outputFile, std::ios::binary);
+  if (!outStream.is_open()) {
+    SIO_THROW(sio::error_code::not_open, "Couldn't open output stream '" + outputFile + "'");
+  }
+
+  SIOFileTOCRecord tocRecord{};
+  DatamodelDefinitionHolder::MapType edmDefinitions{};
+  std::optional<podio::version::Version> fileVersion{};
+
+  for (const auto& filename : inputFiles) {
+    sio::ifstream inStream;
+    inStream.open(filename, std::ios::binary);
+    if (!inStream.is_open()) {
+      throw std::runtime_error("File " + filename + " couldn't be opened");
+    }
+
+    // NOTE: reading TOC record first because that jumps back to the start of the file!
+    const auto inTocRecord = readFileTOCRecord(inStream, filename);
+    const auto version = readPodioHeader(inStream);
+    if (!fileVersion) {
+      fileVersion = version;
+      sio::block_list blocks;
+      blocks.emplace_back(std::make_shared<SIOVersionBlock>(version));
+      // write the version uncompressed
+      sio_utils::writeRecord(blocks, "podio_header_info", outStream, sizeof(podio::version::Version), false);
+    } else if (version != *fileVersion) {
+      throw std::runtime_error("File " + filename + " has been written with podio version " + std::string(version) +
+                               " but the previous files with version " + std::string(*fileVersion));
+    }
+
+    for (const auto& recordName : inTocRecord.getRecordNames()) {
+      const auto name = std::string(recordName);
+      if (name == sio_helpers::SIOEDMDefinitionName) {
+        if (!mergeDatamodelDefinitions(edmDefinitions, readEDMDefinitions(inStream, inTocRecord.getPosition(name)))) {
+          std::cerr << "PODIO WARNING: The input files have different definitions for the same EDM. "
+                       "Only the first one is kept"
+                    << std::endl;
+        }
+        continue;
+      }
+
+      // Every Frame consists of the record with the collection ID table, which
+      // is the one that is in the TOC, immediately followed by the data record
+      for (size_t i = 0; i < inTocRecord.getNRecords(name); ++i) {
+        inStream.seekg(inTocRecord.getPosition(name, i));
+        tocRecord.addRecord(name, copyRecord(inStream, outStream));
+        copyRecord(inStream, outStream);
+      }
+    }
+  }
+
+  sio::block_list blocks;
+  blocks.emplace_back(std::make_shared<podio::SIOMapBlock<std::string, std::string>>(std::move(edmDefinitions)));
+  tocRecord.addRecord(sio_helpers::SIOEDMDefinitionName, sio_utils::writeRecord(blocks, "EDMDefinitions", outStream));
+
+  blocks.clear();
+  blocks.emplace_back(std::make_shared<SIOFileTOCRecordBlock>(&tocRecord));
+  auto tocStartPos = sio_utils::writeRecord(blocks, sio_helpers::SIOTocRecordName, outStream);
+
+  uint64_t finalWords = (((uint64_t)sio_helpers::SIOTocMarker) << 32) | ((uint64_t)tocStartPos & 0xffffffff);
+  outStream.write(reinterpret_cast<char*>(&finalWords), sizeof(finalWords));
+
+  outStream.close();
+}
+
+} // namespace podio
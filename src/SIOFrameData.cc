@@ -1,5 +1,6 @@
 #include "podio/SIOFrameData.h"
 #include "podio/SIOBlock.h"
+#include "podio/Tracing.h"
 
 #include <sio/compression/zlib.h>
 
@@ -63,10 +64,37 @@ void SIOFrameData::unpackBuffers() {
 
   createBlocks();
 
-  sio::zlib_compression compressor;
+  auto start = IOStatsRecorder::Clock::now();
   sio::buffer uncBuffer{m_dataSize};
-  compressor.uncompress(m_recBuffer.span(), uncBuffer);
-  sio::api::read_blocks(uncBuffer.span(), m_blocks);
+  {
+    const auto span = TraceSpan("SIO::uncompress", "io");
+    sio::zlib_compression compressor;
+    compressor.uncompress(m_recBuffer.span(), uncBuffer);
+  }
+  const auto decompressionTime = IOStatsRecorder::elapsedSince(start);
+
+  start = IOStatsRecorder::Clock::now();
+  {
+    const auto span = TraceSpan("SIO::deserialize", "io");
+    sio::api::read_blocks(uncBuffer.span(), m_blocks);
+  }
+
+  if (m_ioStats) {
+    auto frameStats = CollectionIOStats{};
+    frameStats.nEntries = 1;
+    frameStats.serializationTime = IOStatsRecorder::elapsedSince(start);
+    frameStats.compressionTime = decompressionTime;
+    frameStats.compressedBytes = m_recBuffer.size();
+    frameStats.uncompressedBytes = m_dataSize;
+
+    auto collStats = std::vector<std::pair<std::string, CollectionIOStats>>{};
+    collStats.reserve(m_idTable.names().size());
+    for (const auto& name : m_idTable.names()) {
+      collStats.emplace_back(name, CollectionIOStats{});
+      collStats.back().second.nEntries = 1;
+    }
+    m_ioStats.addFrame(frameStats, collStats);
+  }
 }
 
 void SIOFrameData::createBlocks() {
@@ -86,14 +114,27 @@ void SIOFrameData::createBlocks() {
 }
 
 void SIOFrameData::readIdTable() {
+  auto start = IOStatsRecorder::Clock::now();
   sio::buffer uncBuffer{m_tableSize};
   sio::zlib_compression compressor;
   compressor.uncompress(m_tableBuffer.span(), uncBuffer);
+  const auto decompressionTime = IOStatsRecorder::elapsedSince(start);
 
+  start = IOStatsRecorder::Clock::now();
   sio::block_list blocks;
   blocks.emplace_back(std::make_shared<SIOCollectionIDTableBlock>());
   sio::api::read_blocks(uncBuffer.span(), blocks);
 
+  if (m_ioStats) {
+    // The table is part of the Frame level data
+    auto tableStats = CollectionIOStats{};
+    tableStats.serializationTime = IOStatsRecorder::elapsedSince(start);
+    tableStats.compressionTime = decompressionTime;
+    tableStats.compressedBytes = m_tableBuffer.size();
+    tableStats.uncompressedBytes = m_tableSize;
+    m_ioStats.addFrame(tableStats);
+  }
+
   auto* idTableBlock = static_cast<SIOCollectionIDTableBlock*>(blocks[0].get());
   m_idTable = idTableBlock->getTable();
   m_typeNames = idTableBlock->getTypeNames();
@@ -1,5 +1,6 @@
 #include "podio/SIOReader.h"
 #include "podio/SIOBlock.h"
+#include "podio/Tracing.h"
 
 #include "sioUtils.h"
 
@@ -28,6 +29,7 @@ void SIOReader::openFile(const std::string& filename) {
 }
 
 std::unique_ptr<SIOFrameData> SIOReader::readNextEntry(const std::string& name) {
+  const auto span = TraceSpan("SIOReader::readNextEntry", "io", name);
   // Skip to where the next record of this name starts in the file, based on
   // how many times we have already read this name
   //
@@ -45,7 +47,9 @@ std::unique_ptr<SIOFrameData> SIOReader::readNextEntry(const std::string& name)
   m_nameCtr[name]++;
 
   return std::make_unique<SIOFrameData>(std::move(dataBuffer), dataInfo._uncompressed_length, std::move(tableBuffer),
-                                        tableInfo._uncompressed_length);
+                                        tableInfo._uncompressed_length,
+                                        m_ioStats ? IOStatsRecorder(m_ioStats, name) : IOStatsRecorder{},
+                                        m_bufferPolicy);
 }
 
 std::unique_ptr<SIOFrameData> SIOReader::readEntry(const std::string& name, const unsigned entry) {
@@ -4,6 +4,7 @@
 #include "podio/Frame.h"
 #include "podio/GenericParameters.h"
 #include "podio/SIOBlock.h"
+#include "podio/Tracing.h"
 
 #include "sioUtils.h"
 
@@ -12,7 +13,7 @@
 
 namespace podio {
 
-SIOWriter::SIOWriter(const std::string& filename) {
+SIOWriter::SIOWriter(const std::string& filename, int compressionLevel) : m_compressionLevel(compressionLevel) {
   m_stream.open(filename, std::ios::binary);
   if (!m_stream.is_open()) {
     SIO_THROW(sio::error_code::not_open, "Couldn't open output stream '" + filename + "'");
@@ -38,22 +39,39 @@ void SIOWriter::writeFrame(const podio::Frame& frame, const std::string& categor
 
 void SIOWriter::writeFrame(const podio::Frame& frame, const std::string& category,
                            const std::vector<std::string>& collsToWrite) {
+  const auto span = TraceSpan("SIOWriter::writeFrame", "io", category);
   std::vector<sio_utils::StoreCollection> collections;
   collections.reserve(collsToWrite.size());
+  std::vector<std::pair<std::string, CollectionIOStats>> collStats;
   for (const auto& name : collsToWrite) {
+    const auto start = IOStatsRecorder::Clock::now();
     collections.emplace_back(name, frame.getCollectionForWrite(name));
+    if (m_ioStats) {
+      collStats.emplace_back(name, CollectionIOStats{});
+      collStats.back().second.nEntries = 1;
+      collStats.back().second.prepareTime = IOStatsRecorder::elapsedSince(start);
+    }
     m_datamodelCollector.registerDatamodelDefinition(collections.back().second, name);
   }
 
+  auto frameStats = CollectionIOStats{};
+  frameStats.nEntries = 1;
+  auto* stats = m_ioStats ? &frameStats : nullptr;
+
   // Write necessary metadata and the actual data into two different records.
   // Otherwise we cannot easily unpack the data record, because necessary
   // information is contained within the record.
   sio::block_list tableBlocks;
   tableBlocks.emplace_back(sio_utils::createCollIDBlock(collections, frame.getCollectionIDTableForWrite()));
-  m_tocRecord.addRecord(category, sio_utils::writeRecord(tableBlocks, category + "_HEADER", m_stream));
+  m_tocRecord.addRecord(category, sio_utils::writeRecord(tableBlocks, category + "_HEADER", m_stream, sio::mbyte,
+                                                         true, m_compressionLevel, stats));
 
   const auto blocks = sio_utils::createBlocks(collections, frame.getParameters());
-  sio_utils::writeRecord(blocks, category, m_stream);
+  sio_utils::writeRecord(blocks, category, m_stream, sio::mbyte, true, m_compressionLevel, stats);
+
+  if (m_ioStats) {
+    m_ioStats->addFrame(category, frameStats, collStats);
+  }
 }
 
 void SIOWriter::finish() {
@@ -1,5 +1,6 @@
 #include "podio/SchemaEvolution.h"
 #include "podio/CollectionBuffers.h"
+#include "podio/Tracing.h"
 
 #include <iostream>
 
@@ -22,6 +23,7 @@ podio::CollectionReadBuffers SchemaEvolution::evolveBuffers(const podio::Collect
     if (fromVersion == currentVersion) {
       return oldBuffers; // Nothing to do here
     }
+    const auto span = TraceSpan("SchemaEvolution::evolveBuffers", "schema-evolution", collType);
 
     const auto& typeEvolFuncs = m_evolutionFuncs[mapIndex];
     if (fromVersion < typeEvolFuncs.size()) {
@@ -0,0 +1,179 @@
+#include "podio/Tracing.h"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace podio {
+
+struct Tracer::ThreadBuffer {
+  /// Store the span, overwriting the oldest one once the capacity is reached.
+  /// The capacity is only read under the lock, so that no span survives the
+  /// clear of setCapacity with the old capacity
+  void push(Span&& span, const std::atomic<size_t>& capacity) {
+    std::lock_guard lock{mutex};
+    if (spans.size() < capacity.load(std::memory_order_relaxed)) {
+      spans.emplace_back(std::move(span));
+      return;
+    }
+    ++dropped;
+    if (spans.empty()) {
+      return;
+    }
+    spans[next] = std::move(span);
+    next = (next + 1) % spans.size();
+  }
+
+  /// Append the spans to the passed ones, oldest first
+  void copyTo(std::vector<Span>& other) const {
+    std::lock_guard lock{mutex};
+    other.insert(other.end(), spans.begin() + next, spans.end());
+    other.insert(other.end(), spans.begin(), spans.begin() + next);
+  }
+
+  void clear() {
+    std::lock_guard lock{mutex};
+    spans.clear();
+    next = 0;
+    dropped = 0;
+  }
+
+  mutable std::mutex mutex{};
+  std::vector<Span> spans{};
+  size_t next{0}; ///< The oldest span (and the next one to overwrite) once full
+  size_t dropped{0};
+};
+
+namespace {
+  /// Get a small ID for the calling thread, which is more readable in the
+  /// trace viewers than the (hashed) std::thread::id
+  uint32_t currentThreadID() {
+    static std::atomic<uint32_t> nextID{0};
+    thread_local const uint32_t threadID = nextID++;
+    return threadID;
+  }
+
+  /// Write the string with all characters escaped that need escaping in JSON
+  void writeEscaped(std::ostream& os, const std::string& str) {
+    for (const auto c : str) {
+      switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          os << buffer;
+        } else {
+          os << c;
+        }
+      }
+    }
+  }
+
+  /// Write the nanoseconds as (fractional) microseconds, which is the time
+  /// unit of the Chrome trace event format
+  void writeMicroseconds(std::ostream& os, int64_t ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", static_cast<long long>(ns / 1000),
+                  static_cast<long long>(ns % 1000));
+    os << buffer;
+  }
+} // namespace
+
+Tracer& Tracer::instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer() {
+  // The Tracer keeps the buffers alive, such that the spans of threads that
+  // have finished are still available
+  thread_local ThreadBuffer* buffer = [this]() {
+    auto newBuffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard lock{m_mutex};
+    return m_buffers.emplace_back(std::move(newBuffer)).get();
+  }();
+  return *buffer;
+}
+
+void Tracer::record(const char* name, const char* category, std::string detail, Clock::time_point start) {
+  const auto end = Clock::now();
+  auto span = Span{name,
+                   category,
+                   std::move(detail),
+                   currentThreadID(),
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(start - m_epoch).count(),
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()};
+
+  threadBuffer().push(std::move(span), m_capacity);
+}
+
+std::vector<Tracer::Span> Tracer::getSpans() const {
+  std::lock_guard lock{m_mutex};
+  std::vector<Span> spans;
+  for (const auto& buffer : m_buffers) {
+    buffer->copyTo(spans);
+  }
+  return spans;
+}
+
+void Tracer::clear() {
+  std::lock_guard lock{m_mutex};
+  for (auto& buffer : m_buffers) {
+    buffer->clear();
+  }
+}
+
+void Tracer::setCapacity(size_t capacity) {
+  m_capacity.store(capacity, std::memory_order_relaxed);
+  clear();
+}
+
+size_t Tracer::droppedSpans() const {
+  std::lock_guard lock{m_mutex};
+  size_t dropped = 0;
+  for (const auto& buffer : m_buffers) {
+    std::lock_guard bufferLock{buffer->mutex};
+    dropped += buffer->dropped;
+  }
+  return dropped;
+}
+
+void Tracer::writeChromeTrace(std::ostream& os) const {
+  const auto spans = getSpans();
+
+  os << "{\"traceEvents\":[";
+  for (size_t i = 0; i < spans.size(); ++i) {
+    const auto& span = spans[i];
+    os << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+    writeEscaped(os, span.name);
+    os << "\",\"cat\":\"";
+    writeEscaped(os, span.category);
+    os << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << span.threadID << ",\"ts\":";
+    writeMicroseconds(os, span.start);
+    os << ",\"dur\":";
+    writeMicroseconds(os, span.duration);
+    if (!span.detail.empty()) {
+      os << ",\"args\":{\"detail\":\"";
+      writeEscaped(os, span.detail);
+      os << "\"}";
+    }
+    os << "}";
+  }
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void Tracer::writeChromeTrace(const std::string& filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    throw std::runtime_error("Cannot open file '" + filename + "' for writing the trace");
+  }
+  writeChromeTrace(file);
+}
+
+} // namespace podio
@@ -20,7 +20,7 @@ namespace {
     // Register with schema version 1 to allow for potential changes
     CollectionBufferFactory::mutInstance().registerCreationFunc(
         userDataCollTypeName<T>(), UserDataCollection<T>::schemaVersion, [](bool) {
-          return podio::CollectionReadBuffers{
+          auto readBuffers = podio::CollectionReadBuffers{
               new std::vector<T>(),
               nullptr,
               nullptr,
@@ -33,6 +33,10 @@ namespace {
                 buffers.data = podio::CollectionWriteBuffers::asVector<T>(buffers.data);
               },
               [](podio::CollectionReadBuffers& buffers) { delete static_cast<std::vector<T>*>(buffers.data); }};
+          readBuffers.size = [](const podio::CollectionReadBuffers& buffers) -> size_t {
+            return static_cast<const std::vector<T>*>(buffers.data)->size();
+          };
+          return readBuffers;
         });
 
     // For now passing the same schema version for from and current versions
@@ -0,0 +1,87 @@
+#include "podio/UserDataTable.h"
+#include "podio/CollectionBufferFactory.h"
+#include "podio/CollectionBuffers.h"
+#include "podio/SchemaEvolution.h"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace podio {
+
+namespace {
+  /**
+   * Helper function to register a UserDataTable to the CollectionBufferFactory.
+   * Takes the BasicType as template argument.
+   *
+   * Returns an integer so that it can be used with std::apply
+   */
+  template <typename T>
+  int registerUserDataTable(T) {
+    CollectionBufferFactory::mutInstance().registerCreationFunc(
+        userDataTableTypeName<T>(), UserDataTable<T>::schemaVersion, [](bool) {
+          auto vecMembers = new podio::VectorMembersInfo();
+          vecMembers->emplace_back("std::string", new std::vector<std::string>());
+          auto readBuffers = podio::CollectionReadBuffers{
+              new std::vector<T>(),
+              new podio::CollRefCollection(),
+              vecMembers,
+              podio::UserDataTable<T>::schemaVersion,
+              podio::userDataTableTypeName<T>(),
+              [](podio::CollectionReadBuffers buffers, bool) {
+                auto values = std::unique_ptr<std::vector<T>>(buffers.dataAsVector<T>());
+                auto names = std::unique_ptr<std::vector<std::string>>(
+                    podio::CollectionReadBuffers::asVector<std::string>((*buffers.vectorMembers)[0].second));
+                delete buffers.references;
+                delete buffers.vectorMembers;
+                return std::make_unique<UserDataTable<T>>(std::move(*names), *values);
+              },
+              [](podio::CollectionReadBuffers& buffers) {
+                buffers.data = podio::CollectionWriteBuffers::asVector<T>(buffers.data);
+                (*buffers.vectorMembers)[0].second =
+                    podio::CollectionWriteBuffers::asVector<std::string>((*buffers.vectorMembers)[0].second);
+              },
+              [](podio::CollectionReadBuffers& buffers) {
+                delete static_cast<std::vector<T>*>(buffers.data);
+                delete static_cast<std::vector<std::string>*>((*buffers.vectorMembers)[0].second);
+                delete buffers.references;
+                delete buffers.vectorMembers;
+              }};
+          // The size of a table is its number of rows
+          readBuffers.size = [](const podio::CollectionReadBuffers& buffers) -> size_t {
+            const auto* names = static_cast<const std::vector<std::string>*>((*buffers.vectorMembers)[0].second);
+            return names->empty() ? 0 : static_cast<const std::vector<T>*>(buffers.data)->size() / names->size();
+          };
+          return readBuffers;
+        });
+
+    // For now passing the same schema version for from and current versions
+    // just to make SchemaEvolution aware of UserDataTables.
+    podio::SchemaEvolution::mutInstance().registerEvolutionFunc(
+        podio::userDataTableTypeName<T>(), UserDataTable<T>::schemaVersion, UserDataTable<T>::schemaVersion,
+        SchemaEvolution::noOpSchemaEvolution, SchemaEvolution::Priority::AutoGenerated);
+
+    return 1;
+  }
+
+  /**
+   * Helper function to loop over all types in the SupportedUserDataTypes to
+   * register the UserDataTable types.
+   */
+  bool registerUserDataTables() {
+    // Use an IILE here to make sure to do the call exactly once
+    const static auto reg = []() {
+      std::apply([](auto... x) { std::make_tuple(registerUserDataTable(x)...); }, SupportedUserDataTypes{});
+      return true;
+    }();
+    return reg;
+  }
+
+  /**
+   * Invoke the registration function for user data tables at least once
+   */
+  const auto registeredUserDataTables = registerUserDataTables();
+} // namespace
+
+} // namespace podio
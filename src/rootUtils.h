@@ -5,6 +5,7 @@
 #include "podio/CollectionBranches.h"
 #include "podio/CollectionBuffers.h"
 #include "podio/CollectionIDTable.h"
+#include "podio/IOStats.h"
 
 #include "TBranch.h"
 #include "TChain.h"
@@ -223,6 +224,31 @@ inline void readBranchesData(const CollectionBranches& branches, Long64_t entry)
   }
 }
 
+/**
+ * Read all data and record the number of bytes that have been read. ROOT only
+ * keeps track of the compression of the whole branch, so the compressed size of
+ * a single entry is estimated from that.
+ */
+inline void readBranchesData(const CollectionBranches& branches, Long64_t entry, podio::CollectionIOStats& stats) {
+  const auto readBranch = [&stats, entry](TBranch* branch) {
+    const auto nBytes = branch->GetEntry(entry);
+    stats.uncompressedBytes += nBytes;
+    if (const auto totBytes = branch->GetTotBytes("*"); totBytes > 0) {
+      stats.compressedBytes += static_cast<uint64_t>(nBytes * static_cast<double>(branch->GetZipBytes("*")) / totBytes);
+    }
+  };
+
+  if (branches.data) {
+    readBranch(branches.data);
+  }
+  for (auto* br : branches.refs) {
+    readBranch(br);
+  }
+  for (auto* br : branches.vecs) {
+    readBranch(br);
+  }
+}
+
 /**
  * reconstruct the collection info from information that is available from other
  * trees in the file.
@@ -3,7 +3,9 @@
 
 #include "podio/CollectionBase.h"
 #include "podio/GenericParameters.h"
+#include "podio/IOStats.h"
 #include "podio/SIOBlock.h"
+#include "podio/Tracing.h"
 
 #include <sio/api.h>
 #include <sio/compression/zlib.h>
@@ -79,24 +81,45 @@ namespace sio_utils {
   }
 
   /// Write the passed record and return where it starts in the file
+  /// Write the blocks into a record with the given name. If stats are passed
+  /// the bytes and times of (compressing and) serializing the record are
+  /// added to them
   inline sio::ifstream::pos_type writeRecord(const sio::block_list& blocks, const std::string& recordName,
                                              sio::ofstream& stream, std::size_t initBufferSize = sio::mbyte,
-                                             bool compress = true) {
+                                             bool compress = true, int compressionLevel = 6,
+                                             podio::CollectionIOStats* stats = nullptr) {
+    auto start = podio::IOStatsRecorder::Clock::now();
     auto buffer = sio::buffer{initBufferSize};
-    auto recInfo = sio::api::write_record(recordName, buffer, blocks, 0);
+    auto recInfo = [&]() {
+      const auto span = podio::TraceSpan("SIO::serialize", "io", recordName);
+      return sio::api::write_record(recordName, buffer, blocks, 0);
+    }();
+    if (stats) {
+      stats->serializationTime += podio::IOStatsRecorder::elapsedSince(start);
+    }
 
     if (compress) {
+      start = podio::IOStatsRecorder::Clock::now();
+      const auto span = podio::TraceSpan("SIO::compress", "io", recordName);
       // use zlib to compress the record into another buffer
       sio::zlib_compression compressor;
-      compressor.set_level(6); // Z_DEFAULT_COMPRESSION==6
+      compressor.set_level(compressionLevel); // Z_DEFAULT_COMPRESSION==6
       auto comBuffer = sio::buffer{initBufferSize};
       sio::api::compress_record(recInfo, buffer, comBuffer, compressor);
+      if (stats) {
+        stats->compressionTime += podio::IOStatsRecorder::elapsedSince(start);
+      }
 
       sio::api::write_record(stream, buffer.span(0, recInfo._header_length), comBuffer.span(), recInfo);
     } else {
       sio::api::write_record(stream, buffer.span(), recInfo);
     }
 
+    if (stats) {
+      stats->compressedBytes += recInfo._data_length;
+      stats->uncompressedBytes += recInfo._uncompressed_length;
+    }
+
     return recInfo._file_start;
   }
 
@@ -12,7 +12,7 @@ if ((NOT "@FORCE_RUN_ALL_TESTS@" STREQUAL "ON") AND (NOT "@USE_SANITIZER@" STREQ
     ${CTEST_CUSTOM_TESTS_IGNORE}
 
     read_and_write_associated
-    check_benchmark_outputs
+    podio-benchmarks-smoke
     read_frame_legacy_root
     read_frame_root_multiple
     write_python_frame_root
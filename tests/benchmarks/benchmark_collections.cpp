@@ -0,0 +1,181 @@
+#include "benchmark_common.h"
+
+#include "datamodel/ExampleClusterCollection.h"
+#include "datamodel/ExampleHitCollection.h"
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+// Micro benchmarks for the basic operations of collections. All of them
+// process collections with a varying number of elements and report the number
+// of processed elements per second
+
+namespace {
+
+void BM_CollectionCreate(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  for (auto _ : state) {
+    auto hits = createHits(nElements);
+    benchmark::DoNotOptimize(hits);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_CollectionCreate)->Range(MinElements, MaxElements);
+
+void BM_CollectionIterate(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  const auto hits = createHits(nElements);
+  for (auto _ : state) {
+    double energy = 0;
+    for (const auto hit : hits) {
+      energy += hit.energy();
+    }
+    benchmark::DoNotOptimize(energy);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_CollectionIterate)->Range(MinElements, MaxElements);
+
+void BM_CollectionIterateRelations(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  const auto hits = createHits(nElements);
+  const auto clusters = createClusters(hits);
+  for (auto _ : state) {
+    double energy = 0;
+    for (const auto cluster : clusters) {
+      for (const auto hit : cluster.Hits()) {
+        energy += hit.energy();
+      }
+    }
+    benchmark::DoNotOptimize(energy);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_CollectionIterateRelations)->Range(MinElements, MaxElements);
+
+// The collections that are prepared are kept alive until the timing is paused
+// again in the next iteration, so that their destruction is not measured
+
+void BM_PrepareForWrite(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = std::optional<ExampleHitCollection>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    hits = createHits(nElements);
+    hits->setID(1);
+    state.ResumeTiming();
+
+    hits->prepareForWrite();
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_PrepareForWrite)->Range(MinElements, MaxElements);
+
+void BM_PrepareForWriteRelations(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = createHits(nElements);
+  hits.setID(1);
+  auto clusters = std::optional<ExampleClusterCollection>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    clusters = createClusters(hits);
+    clusters->setID(2);
+    state.ResumeTiming();
+
+    clusters->prepareForWrite();
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_PrepareForWriteRelations)->Range(MinElements, MaxElements);
+
+void BM_PrepareAfterRead(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = createHits(nElements);
+  auto clusters = createClusters(hits);
+  auto readColls = std::optional<ReadCollections>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto data = InMemoryFrameData{};
+    data.addCollection<ExampleHitData>("hits", hits);
+    data.addCollection<ExampleClusterData>("clusters", clusters);
+    readColls.reset();
+    readColls.emplace(data, std::vector<std::string>{"hits", "clusters"});
+    state.ResumeTiming();
+
+    (*readColls)["hits"]->prepareAfterRead();
+    (*readColls)["clusters"]->prepareAfterRead();
+  }
+  state.SetItemsProcessed(state.iterations() * nElements * 2);
+}
+BENCHMARK(BM_PrepareAfterRead)->Range(MinElements, MaxElements);
+
+/// Prepare the read collections up to the point where setReferences is called
+/// on them
+ReadCollections& prepareReadCollections(std::optional<ReadCollections>& readColls, ExampleHitCollection& hits,
+                                        ExampleClusterCollection& clusters, ExampleHitCollection& hitRefs) {
+  auto data = InMemoryFrameData{};
+  data.addCollection<ExampleHitData>("hits", hits);
+  data.addCollection<ExampleClusterData>("clusters", clusters);
+  data.addCollection<ExampleHitData>("hitRefs", hitRefs);
+  readColls.reset();
+  readColls.emplace(data, std::vector<std::string>{"hits", "clusters", "hitRefs"});
+  for (const auto& name : {"hits", "clusters", "hitRefs"}) {
+    (*readColls)[name]->prepareAfterRead();
+  }
+  return readColls.value();
+}
+
+void BM_SetReferences(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = createHits(nElements);
+  auto clusters = createClusters(hits);
+  auto hitRefs = ExampleHitCollection{};
+  hitRefs.setSubsetCollection();
+  for (const auto hit : hits) {
+    hitRefs.push_back(hit);
+  }
+
+  auto readColls = std::optional<ReadCollections>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto& colls = prepareReadCollections(readColls, hits, clusters, hitRefs);
+    state.ResumeTiming();
+
+    // Normal collections only set up the (lazy) resolution of their relations
+    // here, while subset collections resolve all their elements
+    colls["clusters"]->setReferences(&colls);
+    colls["hitRefs"]->setReferences(&colls);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements * 2);
+}
+BENCHMARK(BM_SetReferences)->Range(MinElements, MaxElements);
+
+void BM_ResolveRelations(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = createHits(nElements);
+  auto clusters = createClusters(hits);
+  auto hitRefs = ExampleHitCollection{};
+  hitRefs.setSubsetCollection();
+
+  auto readColls = std::optional<ReadCollections>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto& colls = prepareReadCollections(readColls, hits, clusters, hitRefs);
+    state.ResumeTiming();
+
+    auto* readClusters = colls["clusters"];
+    readClusters->setReferences(&colls);
+    double energy = 0;
+    for (const auto cluster : *static_cast<ExampleClusterCollection*>(readClusters)) {
+      for (const auto hit : cluster.Hits()) {
+        energy += hit.energy();
+      }
+    }
+    benchmark::DoNotOptimize(energy);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements);
+}
+BENCHMARK(BM_ResolveRelations)->Range(MinElements, MaxElements);
+
+} // namespace
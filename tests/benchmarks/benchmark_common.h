@@ -0,0 +1,83 @@
+#ifndef PODIO_TESTS_BENCHMARKS_BENCHMARK_COMMON_H // NOLINT(llvm-header-guard): folder structure not suitable
+#define PODIO_TESTS_BENCHMARKS_BENCHMARK_COMMON_H // NOLINT(llvm-header-guard): folder structure not suitable
+
+#include "datamodel/ExampleClusterCollection.h"
+#include "datamodel/ExampleHitCollection.h"
+
+#include "podio/CollectionBase.h"
+#include "podio/ICollectionProvider.h"
+
+#include "in_memory_frame_data.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// The range of the number of elements in a collection for the micro benchmarks
+constexpr int64_t MinElements = 1 << 6;
+constexpr int64_t MaxElements = 1 << 15;
+
+/// Create a collection with nHits hits
+inline ExampleHitCollection createHits(int64_t nHits) {
+  ExampleHitCollection hits;
+  for (int64_t i = 0; i < nHits; ++i) {
+    hits.create(static_cast<unsigned long long>(i), 1.0 * i, 2.0 * i, 3.0 * i, 0.5 * i);
+  }
+  return hits;
+}
+
+/// Create a collection with as many clusters as there are hits, where every
+/// cluster points to two hits and all but the first cluster point to the
+/// cluster before them
+inline ExampleClusterCollection createClusters(const ExampleHitCollection& hits) {
+  ExampleClusterCollection clusters;
+  for (size_t i = 0; i < hits.size(); ++i) {
+    auto cluster = clusters.create();
+    cluster.addHits(hits[i]);
+    cluster.addHits(hits[(i + 1) % hits.size()]);
+    cluster.energy(hits[i].energy() + hits[(i + 1) % hits.size()].energy());
+    if (i > 0) {
+      cluster.addClusters(clusters[i - 1]);
+    }
+  }
+  return clusters;
+}
+
+/**
+ * Collections that have been constructed from the buffers of an
+ * InMemoryFrameData, i.e. in the same state as collections that have just been
+ * read from file. This is also the collection provider for setReferences.
+ */
+class ReadCollections : public podio::ICollectionProvider {
+public:
+  ReadCollections(InMemoryFrameData& data, const std::vector<std::string>& names) {
+    const auto idTable = data.getIDTable();
+    for (const auto& name : names) {
+      auto buffers = data.getCollectionBuffers(name).value();
+      auto coll = buffers.createCollection(buffers, buffers.data == nullptr);
+      coll->setID(idTable.collectionID(name).value());
+      m_collections.emplace(name, std::move(coll));
+    }
+  }
+
+  podio::CollectionBase* operator[](const std::string& name) {
+    return m_collections.at(name).get();
+  }
+
+  bool get(uint32_t collectionID, podio::CollectionBase*& collection) const override {
+    for (const auto& [_, coll] : m_collections) {
+      if (coll->getID() == collectionID) {
+        collection = coll.get();
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::map<std::string, std::unique_ptr<podio::CollectionBase>> m_collections{};
+};
+
+#endif // PODIO_TESTS_BENCHMARKS_BENCHMARK_COMMON_H
@@ -0,0 +1,96 @@
+#include "benchmark_common.h"
+
+#include "datamodel/ExampleClusterCollection.h"
+#include "datamodel/ExampleHitCollection.h"
+
+#include "podio/Frame.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Micro benchmarks for putting collections into and getting them from a Frame
+
+namespace {
+
+/// The range of the number of collections in a Frame
+constexpr int64_t MinCollections = 1 << 2;
+constexpr int64_t MaxCollections = 1 << 8;
+
+std::vector<std::string> collectionNames(int64_t nCollections) {
+  std::vector<std::string> names;
+  names.reserve(nCollections);
+  for (int64_t i = 0; i < nCollections; ++i) {
+    names.emplace_back("hits_" + std::to_string(i));
+  }
+  return names;
+}
+
+void BM_FramePut(benchmark::State& state) {
+  const auto names = collectionNames(state.range(0));
+  auto frame = std::optional<podio::Frame>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    frame.emplace();
+    auto collections = std::vector<ExampleHitCollection>(names.size());
+    for (auto& coll : collections) {
+      coll.create();
+    }
+    state.ResumeTiming();
+
+    for (size_t i = 0; i < names.size(); ++i) {
+      frame->put(std::move(collections[i]), names[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_FramePut)->Range(MinCollections, MaxCollections);
+
+void BM_FrameGet(benchmark::State& state) {
+  const auto names = collectionNames(state.range(0));
+  auto frame = podio::Frame{};
+  for (const auto& name : names) {
+    frame.put(createHits(1), name);
+  }
+
+  for (auto _ : state) {
+    for (const auto& name : names) {
+      benchmark::DoNotOptimize(&frame.get<ExampleHitCollection>(name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_FrameGet)->Range(MinCollections, MaxCollections);
+
+/// Getting a collection from a Frame that has been constructed from raw data,
+/// i.e. the Frame unpacks the collection and resolves its relations
+void BM_FrameGetFromData(benchmark::State& state) {
+  const auto nElements = state.range(0);
+  auto hits = createHits(nElements);
+  auto clusters = createClusters(hits);
+
+  auto frame = std::optional<podio::Frame>{};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto data = std::make_unique<InMemoryFrameData>();
+    data->addCollection<ExampleHitData>("hits", hits);
+    data->addCollection<ExampleClusterData>("clusters", clusters);
+    frame.emplace(std::move(data));
+    state.ResumeTiming();
+
+    double energy = 0;
+    for (const auto cluster : frame->get<ExampleClusterCollection>("clusters")) {
+      for (const auto hit : cluster.Hits()) {
+        energy += hit.energy();
+      }
+    }
+    benchmark::DoNotOptimize(energy);
+  }
+  state.SetItemsProcessed(state.iterations() * nElements * 2);
+}
+BENCHMARK(BM_FrameGetFromData)->Range(MinElements, MaxElements);
+
+} // namespace
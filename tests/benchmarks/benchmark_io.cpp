@@ -0,0 +1,111 @@
+#include "write_frame.h"
+
+#include "podio/Frame.h"
+#include "podio/ROOTReader.h"
+#include "podio/ROOTWriter.h"
+
+#ifndef PODIO_ENABLE_SIO
+  #define PODIO_ENABLE_SIO 0
+#endif
+#if PODIO_ENABLE_SIO
+  #include "podio/SIOReader.h"
+  #include "podio/SIOWriter.h"
+#endif
+
+#if PODIO_ENABLE_RNTUPLE
+  #include "podio/RNTupleReader.h"
+  #include "podio/RNTupleWriter.h"
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+// Macro benchmarks writing and reading complete Frames (with all collections
+// of the test datamodel) with all available backends
+
+namespace {
+
+struct ROOTBackend {
+  using WriterT = podio::ROOTWriter;
+  using ReaderT = podio::ROOTReader;
+  static constexpr auto extension = ".root";
+};
+
+#if PODIO_ENABLE_RNTUPLE
+struct RNTupleBackend {
+  using WriterT = podio::RNTupleWriter;
+  using ReaderT = podio::RNTupleReader;
+  static constexpr auto extension = ".rntuple.root";
+};
+#endif
+
+#if PODIO_ENABLE_SIO
+struct SIOBackend {
+  using WriterT = podio::SIOWriter;
+  using ReaderT = podio::SIOReader;
+  static constexpr auto extension = ".sio";
+};
+#endif
+
+std::vector<podio::Frame> makeFrames(int64_t nFrames) {
+  std::vector<podio::Frame> frames;
+  frames.reserve(nFrames);
+  for (int64_t i = 0; i < nFrames; ++i) {
+    frames.emplace_back(makeFrame(static_cast<int>(i)));
+  }
+  return frames;
+}
+
+template <typename Backend>
+void writeFrames(const std::string& filename, const std::vector<podio::Frame>& frames) {
+  typename Backend::WriterT writer(filename);
+  for (const auto& frame : frames) {
+    writer.writeFrame(frame, podio::Category::Event);
+  }
+  writer.finish();
+}
+
+template <typename Backend>
+void BM_WriteFrames(benchmark::State& state) {
+  const auto frames = makeFrames(state.range(0));
+  const auto filename = std::string("benchmark_write_frames") + Backend::extension;
+  for (auto _ : state) {
+    writeFrames<Backend>(filename, frames);
+  }
+  state.SetItemsProcessed(state.iterations() * frames.size());
+}
+
+/// Read all Frames and get all their collections, i.e. also measure the
+/// unpacking of the collections
+template <typename Backend>
+void BM_ReadFrames(benchmark::State& state) {
+  const auto filename = std::string("benchmark_read_frames") + Backend::extension;
+  writeFrames<Backend>(filename, makeFrames(state.range(0)));
+
+  for (auto _ : state) {
+    typename Backend::ReaderT reader{};
+    reader.openFile(filename);
+    while (auto data = reader.readNextEntry(podio::Category::Event)) {
+      const auto frame = podio::Frame(std::move(data));
+      for (const auto& name : frame.getAvailableCollections()) {
+        benchmark::DoNotOptimize(frame.get(name));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_WriteFrames, ROOTBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadFrames, ROOTBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+#if PODIO_ENABLE_RNTUPLE
+BENCHMARK_TEMPLATE(BM_WriteFrames, RNTupleBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadFrames, RNTupleBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+#endif
+#if PODIO_ENABLE_SIO
+BENCHMARK_TEMPLATE(BM_WriteFrames, SIOBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadFrames, SIOBackend)->Arg(100)->Unit(benchmark::kMillisecond);
+#endif
+
+} // namespace
@@ -9,8 +9,13 @@
 #include "extension_model/ExternalRelationTypeCollection.h"
 
 #include "podio/Frame.h"
+#include "podio/FrameSkimmer.h"
+#include "podio/UserDataTable.h"
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #define ASSERT(condition, msg)                                                                                         \
   if (!(condition)) {                                                                                                  \
@@ -69,6 +74,18 @@ void checkVecMemSubsetColl(const podio::Frame& event) {
   ASSERT(subsetColl[0] == origColl[0], "subset coll does not have the right contents");
 }
 
+void checkUserDataTable(const podio::Frame& event, int iEvent) {
+  const auto& table = event.get<podio::UserDataTable<float>>("userTable");
+  ASSERT(table.size() == static_cast<size_t>(iEvent + 2), "userTable does not have the expected number of rows");
+  ASSERT((table.columnNames() == std::vector<std::string>{"energy", "time"}), "userTable column names not as expected");
+  const auto energy = table.column("energy");
+  const auto time = table.column("time");
+  for (size_t row = 0; row < table.size(); ++row) {
+    ASSERT(energy[row] == row * 1.5f, "userTable energy value not as expected");
+    ASSERT(time[row] == iEvent + row * 0.5f, "userTable time value not as expected");
+  }
+}
+
 template <typename ReaderT>
 int read_frames(const std::string& filename, bool assertBuildVersion = true) {
   auto reader = ReaderT();
@@ -125,6 +142,9 @@ int read_frames(const std::string& filename, bool assertBuildVersion = true) {
     if (reader.currentFileVersion() >= podio::version::Version{0, 16, 99}) {
       checkVecMemSubsetColl(otherFrame);
     }
+    if (reader.currentFileVersion() >= podio::version::Version{0, 99, 0}) {
+      checkUserDataTable(otherFrame, i + 100);
+    }
   }
 
   if (reader.readNextEntry(podio::Category::Event)) {
@@ -169,4 +189,90 @@ int read_frames(const std::string& filename, bool assertBuildVersion = true) {
   return 0;
 }
 
+/**
+ * Check the contents of a file that has been created by merging the file
+ * written by write_frame.h nInputs times.
+ */
+template <typename ReaderT>
+int read_merged_frames(const std::string& filename, unsigned nInputs) {
+  auto reader = ReaderT();
+  reader.openFile(filename);
+
+  for (const auto& category : {"events", "other_events"}) {
+    if (reader.getEntries(category) != 10 * nInputs) {
+      std::cerr << "Could not read back the number of " << category << " correctly. "
+                << "(expected:" << 10 * nInputs << ", actual: " << reader.getEntries(category) << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  const auto datamodels = reader.getAvailableDatamodels();
+  for (const auto& name : {"datamodel", "extension_model"}) {
+    if (std::find(datamodels.begin(), datamodels.end(), name) == datamodels.end()) {
+      std::cerr << "The definition of " << name << " is not available in the merged file" << std::endl;
+      return 1;
+    }
+  }
+
+  for (unsigned i = 0; i < reader.getEntries("events"); ++i) {
+    auto frame = podio::Frame(reader.readEntry("events", i));
+    processEvent(frame, i % 10, reader.currentFileVersion());
+
+    auto otherFrame = podio::Frame(reader.readEntry("other_events", i));
+    processEvent(otherFrame, (i % 10) + 100, reader.currentFileVersion());
+    processExtensions(otherFrame, (i % 10) + 100, reader.currentFileVersion());
+  }
+
+  return 0;
+}
+
+/// Skim some entries of the events category with only the OneRelation
+/// collection and check that the related collections have been written as well
+template <typename ReaderT, typename WriterT>
+int skim_and_read_frames(const std::string& inputFile, const std::string& outputFile) {
+  const auto entries = std::vector<unsigned>{7, 2, 5};
+  {
+    auto reader = ReaderT();
+    reader.openFile(inputFile);
+    auto writer = WriterT(outputFile);
+    if (podio::skimFrames(reader, writer, "events", entries, {"OneRelation"}) != entries.size()) {
+      std::cerr << "Could not skim the expected number of entries" << std::endl;
+      return 1;
+    }
+    writer.finish();
+  }
+
+  auto reader = ReaderT();
+  reader.openFile(inputFile);
+  auto skimReader = ReaderT();
+  skimReader.openFile(outputFile);
+  if (skimReader.getEntries("events") != entries.size() || skimReader.getEntries("other_events") != 0) {
+    std::cerr << "The skimmed file does not have the expected number of entries" << std::endl;
+    return 1;
+  }
+
+  for (unsigned i = 0; i < entries.size(); ++i) {
+    const auto frame = podio::Frame(reader.readEntry("events", entries[i]));
+    const auto skimFrame = podio::Frame(skimReader.readEntry("events", i));
+
+    auto collections = skimFrame.getAvailableCollections();
+    std::sort(collections.begin(), collections.end());
+    if (collections != std::vector<std::string>{"OneRelation", "clusters", "hits"}) {
+      std::cerr << "The skimmed file does not have the expected collections" << std::endl;
+      return 1;
+    }
+
+    const auto cluster = frame.get<ExampleWithOneRelationCollection>("OneRelation")[0].cluster();
+    const auto skimCluster = skimFrame.get<ExampleWithOneRelationCollection>("OneRelation")[0].cluster();
+    ASSERT(skimCluster.energy() == cluster.energy(), "Related cluster of the skimmed entry is not as expected");
+    ASSERT(skimCluster.Hits_size() == cluster.Hits_size(), "Related hits of the skimmed entry are not as expected");
+    for (size_t j = 0; j < cluster.Hits_size(); ++j) {
+      ASSERT(skimCluster.Hits(j).energy() == cluster.Hits(j).energy(),
+             "Related hits of the skimmed entry are not as expected");
+    }
+  }
+
+  return 0;
+}
+
 #endif // PODIO_TESTS_READ_FRAME_H
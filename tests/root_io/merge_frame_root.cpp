@@ -0,0 +1,35 @@
+#include "read_frame.h"
+#include "read_frame_auxiliary.h"
+
+#include "podio/ROOTFileMerger.h"
+#include "podio/ROOTReader.h"
+
+#include <iostream>
+
+int main() {
+  // Merging only one file has to give back a file with the same contents
+  if (!podio::mergeROOTFiles({"example_frame.root"}, "example_frame_merged.root")) {
+    std::cerr << "Merging a single file should fast clone it" << std::endl;
+    return 1;
+  }
+  if (read_frames<podio::ROOTReader>("example_frame_merged.root") +
+      test_frame_aux_info<podio::ROOTReader>("example_frame_merged.root")) {
+    return 1;
+  }
+
+  if (!podio::mergeROOTFiles({"example_frame.root", "example_frame.root"}, "example_frame_merged_twice.root")) {
+    std::cerr << "Merging files with the same contents should fast clone them" << std::endl;
+    return 1;
+  }
+  if (read_merged_frames<podio::ROOTReader>("example_frame_merged_twice.root", 2)) {
+    return 1;
+  }
+
+  // Reading and writing all Frames has to give the same results
+  if (podio::mergeROOTFiles({"example_frame.root", "example_frame.root"}, "example_frame_merged_rewritten.root",
+                            false)) {
+    std::cerr << "Merging should not fast clone if it is disabled" << std::endl;
+    return 1;
+  }
+  return read_merged_frames<podio::ROOTReader>("example_frame_merged_rewritten.root", 2);
+}
@@ -0,0 +1,8 @@
+#include "read_frame.h"
+
+#include "podio/ROOTReader.h"
+#include "podio/ROOTWriter.h"
+
+int main() {
+  return skim_and_read_frames<podio::ROOTReader, podio::ROOTWriter>("example_frame.root", "example_frame_skimmed.root");
+}
@@ -0,0 +1,17 @@
+#include "read_frame.h"
+#include "read_frame_auxiliary.h"
+
+#include "podio/SIOFileMerger.h"
+#include "podio/SIOReader.h"
+
+int main() {
+  // Merging only one file has to give back a file with the same contents
+  podio::mergeSIOFiles({"example_frame.sio"}, "example_frame_merged.sio");
+  if (read_frames<podio::SIOReader>("example_frame_merged.sio") +
+      test_frame_aux_info<podio::SIOReader>("example_frame_merged.sio")) {
+    return 1;
+  }
+
+  podio::mergeSIOFiles({"example_frame.sio", "example_frame.sio"}, "example_frame_merged_twice.sio");
+  return read_merged_frames<podio::SIOReader>("example_frame_merged_twice.sio", 2);
+}
@@ -0,0 +1,8 @@
+#include "read_frame.h"
+
+#include "podio/SIOReader.h"
+#include "podio/SIOWriter.h"
+
+int main() {
+  return skim_and_read_frames<podio::SIOReader, podio::SIOWriter>("example_frame.sio", "example_frame_skimmed.sio");
+}
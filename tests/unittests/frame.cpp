@@ -1,12 +1,31 @@
 #include "podio/Frame.h"
+#include "podio/FrameCache.h"
+#include "podio/FrameConverter.h"
+#include "podio/FramePrefetcher.h"
+#include "podio/FrameSkimmer.h"
+#include "podio/FrameSummary.h"
+#include "podio/Tracing.h"
 
 #include "catch2/catch_test_macros.hpp"
 
 #include "datamodel/ExampleClusterCollection.h"
 #include "datamodel/ExampleHitCollection.h"
+#include "datamodel/ExampleWithInterfaceRelationCollection.h"
+#include "datamodel/ExampleWithOneRelationCollection.h"
 
+#include "in_memory_frame_data.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -428,3 +447,1101 @@ TEST_CASE("EIC-Jana2 cleanup use case", "[memory-management][492][174]") {
   }
   delete clone;
 }
+
+TEST_CASE("Frame resolves relations lazily", "[frame][relations]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  hits.create(0xbadULL, 0., 0., 0., 42.);
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create(65.);
+  cluster.addHits(hits[0]);
+  cluster.addHits(hits[1]);
+  auto relations = ExampleWithOneRelationCollection();
+  auto rel = relations.create();
+  rel.cluster(cluster);
+  relations.create(); // one without relation
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  frameData->addCollection<ExampleWithOneRelationData>("relations", relations);
+  const auto unpacked = frameData->unpackedCollections();
+
+  const auto frame = podio::Frame(std::move(frameData));
+
+  const auto& readRelations = frame.get<ExampleWithOneRelationCollection>("relations");
+  REQUIRE(readRelations.size() == 2);
+  // Getting a collection does not unpack the collections it points to
+  REQUIRE(*unpacked == std::vector<std::string>{"relations"});
+
+  const auto readCluster = readRelations[0].cluster();
+  REQUIRE(*unpacked == std::vector<std::string>{"relations", "clusters"});
+  REQUIRE(readCluster.energy() == 65.);
+  REQUIRE_FALSE(readRelations[1].cluster().isAvailable());
+
+  // Only accessing the relations actually unpacks the related collections
+  REQUIRE(readCluster.Hits_size() == 2);
+  REQUIRE(*unpacked == std::vector<std::string>{"relations", "clusters"});
+  REQUIRE(readCluster.Hits(1).energy() == 42.);
+  REQUIRE(*unpacked == std::vector<std::string>{"relations", "clusters", "hits"});
+
+  const auto& readHits = frame.get<ExampleHitCollection>("hits");
+  REQUIRE(readCluster.Hits(0) == readHits[0]);
+  REQUIRE(readCluster.Hits(1) == readHits[1]);
+
+  // Clones of read objects get all their relations
+  const auto clonedCluster = readCluster.clone();
+  REQUIRE(clonedCluster.Hits_size() == 2);
+  REQUIRE(clonedCluster.Hits(0) == readHits[0]);
+}
+
+TEST_CASE("Frame OneToManyRelations of read objects", "[frame][relations]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  hits.create(0xbadULL, 0., 0., 0., 42.);
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create(65.);
+  cluster.addHits(hits[1]);
+  cluster.addHits(hits[0]);
+  clusters.create(0.); // one without relations
+  // A collection that will not be available when reading
+  auto missingHits = ExampleHitCollection();
+  missingHits.setID(0x1234);
+  missingHits.create(0xabcULL, 0., 0., 0., 1.);
+  auto interfaceRels = ExampleWithInterfaceRelationCollection();
+  auto intRel = interfaceRels.create();
+  intRel.addmanyEnergies(hits[0]);
+  intRel.addmanyEnergies(cluster);
+  intRel.addmanyEnergies(missingHits[0]);
+  intRel.addmanyEnergies(hits[1]);
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  frameData->addCollection<ExampleWithInterfaceRelationData>("interfaceRels", interfaceRels);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+  const auto& readHits = frame.get<ExampleHitCollection>("hits");
+  REQUIRE(readClusters[1].Hits().empty());
+  REQUIRE(readClusters[1].Hits_begin() == readClusters[1].Hits_end());
+
+  const auto readHitsRange = readClusters[0].Hits();
+  REQUIRE(readHitsRange.size() == 2);
+  REQUIRE(std::distance(readHitsRange.begin(), readHitsRange.end()) == 2);
+  REQUIRE(readHitsRange[0] == readHits[1]);
+  REQUIRE(readHitsRange.at(1) == readHits[0]);
+  REQUIRE_THROWS_AS(readHitsRange.at(2), std::out_of_range);
+  REQUIRE(readHitsRange.begin()->energy() == 42.);
+  REQUIRE((readHitsRange.begin() + 1)->energy() == 23.);
+  REQUIRE(*(readHitsRange.end() - 1) == readHits[0]);
+  auto energies = std::vector<double>{};
+  for (const auto& hit : readHitsRange) {
+    energies.push_back(hit.energy());
+  }
+  REQUIRE(energies == std::vector<double>{42., 23.});
+  REQUIRE(readHitsRange.project(&ExampleHit::energy) == energies);
+
+  // Relations to interface types work across different related collections and
+  // give empty handles for collections that are not available
+  const auto readIntRel = frame.get<ExampleWithInterfaceRelationCollection>("interfaceRels")[0];
+  const auto manyEnergies = readIntRel.manyEnergies();
+  REQUIRE(manyEnergies.size() == 4);
+  REQUIRE(manyEnergies[0] == readHits[0]);
+  REQUIRE(manyEnergies[1] == readClusters[0]);
+  REQUIRE_FALSE(manyEnergies[2].isAvailable());
+  REQUIRE(manyEnergies[3].energy() == 42.);
+
+  // Clones get their own copy of the relations
+  const auto clonedCluster = readClusters[0].clone();
+  REQUIRE(clonedCluster.Hits_size() == 2);
+  REQUIRE(clonedCluster.Hits(0) == readHits[1]);
+  REQUIRE(clonedCluster.Hits(1) == readHits[0]);
+  const auto clonedIntRel = readIntRel.clone();
+  REQUIRE(clonedIntRel.manyEnergies().size() == 4);
+  REQUIRE(clonedIntRel.manyEnergies(1) == readClusters[0]);
+}
+
+TEST_CASE("Frame OneToOneRelations to interface types of read objects", "[frame][relations][interface-types]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  auto clusters = ExampleClusterCollection();
+  clusters.create(65.);
+  auto interfaceRels = ExampleWithInterfaceRelationCollection();
+  for (size_t i = 0; i < 4; ++i) {
+    auto rel = interfaceRels.create();
+    rel.aSingleEnergyType(i % 2 == 0 ? TypeWithEnergy(hits[0]) : TypeWithEnergy(clusters[0]));
+  }
+  interfaceRels.create(); // one without relation
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  frameData->addCollection<ExampleWithInterfaceRelationData>("interfaceRels", interfaceRels);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  const auto& readRels = frame.get<ExampleWithInterfaceRelationCollection>("interfaceRels");
+  const auto& readHits = frame.get<ExampleHitCollection>("hits");
+  const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+  for (size_t i = 0; i < 4; ++i) {
+    const auto related = readRels[i].aSingleEnergyType();
+    if (i % 2 == 0) {
+      REQUIRE(related.isA<ExampleHit>());
+      REQUIRE(related == readHits[0]);
+    } else {
+      REQUIRE(related.isA<ExampleCluster>());
+      REQUIRE(related == readClusters[0]);
+    }
+  }
+  REQUIRE_FALSE(readRels[4].aSingleEnergyType().isAvailable());
+  REQUIRE_FALSE(readRels[0].energyRelation().isAvailable());
+}
+
+TEST_CASE("Frame subset collections of read objects", "[frame][subset-colls]") {
+  auto hits = ExampleHitCollection();
+  auto moreHits = ExampleHitCollection();
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  for (int i = 0; i < 6; ++i) {
+    hits.create(0x42ULL, 0., 0., 0., double(i));
+    moreHits.create(0x42ULL, 0., 0., 0., double(-i));
+  }
+  for (int i = 0; i < 6; ++i) {
+    hitRefs.push_back(hits[5 - i]);
+    if (i % 3 == 0) {
+      hitRefs.push_back(moreHits[i]);
+    }
+  }
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleHitData>("moreHits", moreHits);
+  frameData->addCollection<ExampleHitData>("hitRefs", hitRefs);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  const auto& readRefs = frame.get<ExampleHitCollection>("hitRefs");
+  const auto& readHits = frame.get<ExampleHitCollection>("hits");
+  const auto& readMoreHits = frame.get<ExampleHitCollection>("moreHits");
+  REQUIRE(readRefs.isSubsetCollection());
+  REQUIRE(readRefs.size() == 8);
+  const auto expected = std::vector<ExampleHit>{readHits[5], readMoreHits[0], readHits[4], readHits[3],
+                                                readHits[2], readMoreHits[3], readHits[1], readHits[0]};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    REQUIRE(readRefs[i] == expected[i]);
+  }
+}
+
+TEST_CASE("Frame subset collections pointing into one collection", "[frame][subset-colls]") {
+  auto hits = ExampleHitCollection();
+  auto otherHits = ExampleHitCollection();
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  for (int i = 0; i < 10; ++i) {
+    hits.create(0x42ULL, 0., 0., 0., double(i));
+  }
+  otherHits.create(0x42ULL, 0., 0., 0., -1.);
+  for (int i = 9; i >= 0; i -= 2) {
+    hitRefs.push_back(hits[i]);
+  }
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleHitData>("otherHits", otherHits);
+  frameData->addCollection<ExampleHitData>("hitRefs", hitRefs);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  const auto& readHits = frame.get<ExampleHitCollection>("hits");
+  auto& readRefs = const_cast<ExampleHitCollection&>(frame.get<ExampleHitCollection>("hitRefs"));
+  REQUIRE(readRefs.isSubsetCollection());
+  REQUIRE(readRefs.size() == 5);
+  // Only the indices are stored, but the elements are the ones of the parent
+  REQUIRE(readRefs.memoryUsage().payload == 5 * sizeof(uint32_t));
+  for (size_t i = 0; i < readRefs.size(); ++i) {
+    REQUIRE(readRefs[i] == readHits[9 - 2 * i]);
+    REQUIRE(readRefs.at(i) == readHits[9 - 2 * i]);
+  }
+  REQUIRE_THROWS_AS(readRefs.at(5), std::out_of_range);
+  auto energies = std::vector<double>{};
+  for (const auto hit : readRefs) {
+    energies.push_back(hit.energy());
+  }
+  REQUIRE(energies == std::vector<double>{9., 7., 5., 3., 1.});
+  REQUIRE(readRefs.energy() == energies);
+
+  const auto expectedIDs = [&readHits](const std::vector<size_t>& indices) {
+    auto ids = std::vector<podio::ObjectID>{};
+    for (const auto i : indices) {
+      ids.push_back(readHits[i].getObjectID());
+    }
+    return ids;
+  };
+  const auto writtenIDs = [&readRefs]() {
+    readRefs.prepareForWrite();
+    return *(*readRefs.getBuffers().references)[0];
+  };
+  REQUIRE(writtenIDs() == expectedIDs({9, 7, 5, 3, 1}));
+
+  SECTION("Adding elements of the parent keeps the compact representation") {
+    readRefs.push_back(readHits[0]);
+    REQUIRE(readRefs.size() == 6);
+    REQUIRE(readRefs[5] == readHits[0]);
+    REQUIRE(writtenIDs() == expectedIDs({9, 7, 5, 3, 1, 0}));
+  }
+
+  SECTION("Adding other elements switches to one pointer per element") {
+    const auto otherHit = frame.get<ExampleHitCollection>("otherHits")[0];
+    readRefs.push_back(otherHit);
+    REQUIRE(readRefs.size() == 6);
+    REQUIRE(readRefs.memoryUsage().payload == 6 * sizeof(ExampleHitObj*));
+    for (size_t i = 0; i < 5; ++i) {
+      REQUIRE(readRefs[i] == readHits[9 - 2 * i]);
+    }
+    REQUIRE(readRefs[5] == otherHit);
+    auto ids = expectedIDs({9, 7, 5, 3, 1});
+    ids.push_back(otherHit.getObjectID());
+    REQUIRE(writtenIDs() == ids);
+  }
+}
+
+TEST_CASE("FrameCache resolves objects across Frames", "[frame][frame-cache]") {
+  auto cache = podio::FrameCache();
+  auto timesliceRefs = std::vector<podio::FrameObjectID>{};
+
+  for (uint64_t timeslice = 0; timeslice < 2; ++timeslice) {
+    auto frame = podio::Frame();
+    auto hits = ExampleHitCollection();
+    for (int i = 0; i < 3; ++i) {
+      hits.create(timeslice, 0., 0., 0., double(i));
+    }
+    const auto& storedHits = frame.put(std::move(hits), "hits");
+    timesliceRefs.push_back(podio::makeFrameObjectID(timeslice, storedHits[timeslice + 1]));
+    cache.put(timeslice, std::move(frame));
+  }
+  REQUIRE(cache.size() == 2);
+  REQUIRE_THROWS_AS(cache.put(0, podio::Frame()), std::invalid_argument);
+
+  // Both Frames have a collection with the same name and hence the same ID, but
+  // the references still resolve to the objects of the corresponding Frame
+  REQUIRE(timesliceRefs[0].objectID.collectionID == timesliceRefs[1].objectID.collectionID);
+  for (uint64_t timeslice = 0; timeslice < 2; ++timeslice) {
+    const auto hit = cache.resolve<ExampleHit>(timesliceRefs[timeslice]);
+    REQUIRE(hit.isAvailable());
+    REQUIRE(hit.cellID() == timeslice);
+    REQUIRE(hit.energy() == double(timeslice + 1));
+    REQUIRE(hit == cache.get(timeslice)->get<ExampleHitCollection>("hits")[timeslice + 1]);
+  }
+
+  // Unresolvable references give empty objects
+  const auto validID = timesliceRefs[0].objectID;
+  REQUIRE_FALSE(cache.resolve<ExampleHit>({42, validID}).isAvailable());
+  REQUIRE_FALSE(cache.resolve<ExampleHit>({0, {3, validID.collectionID}}).isAvailable());
+  REQUIRE_FALSE(cache.resolve<ExampleHit>({0, {0, validID.collectionID + 1}}).isAvailable());
+  REQUIRE_FALSE(cache.resolve<ExampleCluster>(timesliceRefs[0]).isAvailable());
+
+  REQUIRE(cache.erase(1));
+  REQUIRE_FALSE(cache.erase(1));
+  REQUIRE(cache.get(1) == nullptr);
+  REQUIRE_FALSE(cache.resolve<ExampleHit>(timesliceRefs[1]).isAvailable());
+}
+
+TEST_CASE("FrameCache resolves objects in read Frames", "[frame][frame-cache]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 4; ++i) {
+    hits.create(0x42ULL, 0., 0., 0., double(i));
+  }
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  const auto unpacked = frameData->unpackedCollections();
+
+  auto cache = podio::FrameCache();
+  const auto& frame = cache.put(7, podio::Frame(std::move(frameData)));
+  const auto hitID = podio::FrameObjectID{7, {2, *frame.getCollectionIDTableForWrite().collectionID("hits")}};
+  REQUIRE(unpacked->empty());
+
+  const auto hit = cache.resolve<ExampleHit>(hitID);
+  REQUIRE(hit.isAvailable());
+  REQUIRE(hit.energy() == 2.);
+  REQUIRE(hit.getObjectID() == hitID.objectID);
+  REQUIRE(*unpacked == std::vector<std::string>{"hits"});
+}
+
+namespace {
+/// Minimal reader that creates Frames with one hit collection, where the
+/// energy of the hit is the entry number
+class InMemoryReader {
+public:
+  explicit InMemoryReader(size_t nEntries) : m_nEntries(nEntries) {
+  }
+
+  std::unique_ptr<InMemoryFrameData> readNextEntry(const std::string& category) {
+    return readEntry(category, m_entry++);
+  }
+
+  std::unique_ptr<InMemoryFrameData> readEntry(const std::string&, size_t entry) {
+    if (entry >= m_nEntries) {
+      return nullptr;
+    }
+    auto hits = ExampleHitCollection();
+    hits.create(0x42ULL, 0., 0., 0., double(entry));
+    auto data = std::make_unique<InMemoryFrameData>();
+    data->addCollection<ExampleHitData>("hits", hits);
+    return data;
+  }
+
+  std::vector<std::string_view> getAvailableCategories() const {
+    return {"events"};
+  }
+
+private:
+  size_t m_nEntries;
+  size_t m_entry{0};
+};
+} // namespace
+
+TEST_CASE("FramePrefetcher reads batches in order", "[frame][prefetch][multithread]") {
+  auto reader = InMemoryReader(10);
+  auto prefetcher = podio::FramePrefetcher(reader, "events", 3, 2, 3);
+
+  std::vector<size_t> batchSizes;
+  std::vector<double> energies;
+  while (true) {
+    const auto batch = prefetcher.nextBatch();
+    if (batch.empty()) {
+      break;
+    }
+    batchSizes.push_back(batch.size());
+    for (const auto& frame : batch) {
+      energies.push_back(frame.get<ExampleHitCollection>("hits")[0].energy());
+    }
+  }
+
+  REQUIRE(batchSizes == std::vector<size_t>{3, 3, 3, 1});
+  REQUIRE(energies == std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  REQUIRE(prefetcher.nextBatch().empty());
+}
+
+TEST_CASE("FramePrefetcher edge cases", "[frame][prefetch][multithread]") {
+  auto reader = InMemoryReader(4);
+  REQUIRE_THROWS_AS(podio::FramePrefetcher(reader, "events", 0), std::invalid_argument);
+
+  SECTION("Exact multiple of the batch size") {
+    auto prefetcher = podio::FramePrefetcher(reader, "events", 2);
+    REQUIRE(prefetcher.nextBatch().size() == 2);
+    REQUIRE(prefetcher.nextBatch().size() == 2);
+    REQUIRE(prefetcher.nextBatch().empty());
+  }
+
+  SECTION("Destroying the prefetcher before all batches are consumed") {
+    auto prefetcher = podio::FramePrefetcher(reader, "events", 1, 2, 2);
+    REQUIRE(prefetcher.nextBatch().size() == 1);
+  }
+}
+
+TEST_CASE("Frame collections retrieved for writing are not unpacked", "[frame][relations]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  hits.create(0xbadULL, 0., 0., 0., 42.);
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create(65.);
+  cluster.addHits(hits[1]);
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  auto* writeClusters = const_cast<podio::CollectionBase*>(frame.getCollectionForWrite("clusters"));
+  REQUIRE(writeClusters->size() == 0);
+  auto buffers = writeClusters->getBuffers();
+  REQUIRE(buffers.dataAsVector<ExampleClusterData>()->size() == 1);
+  REQUIRE((*buffers.references)[0]->size() == 1);
+  REQUIRE(frame.getCollectionForWrite("clusters") == writeClusters);
+  REQUIRE(frame.getAvailableCollections().size() == 2);
+
+  // Unpacking happens only once the collection is actually used
+  const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+  REQUIRE(&readClusters == writeClusters);
+  REQUIRE(readClusters.size() == 1);
+  REQUIRE(readClusters[0].energy() == 65.);
+  REQUIRE(readClusters[0].Hits_size() == 1);
+  REQUIRE(readClusters[0].Hits(0) == frame.get<ExampleHitCollection>("hits")[1]);
+  REQUIRE(frame.getCollectionForWrite("clusters") == writeClusters);
+  REQUIRE(frame.getAvailableCollections().size() == 2);
+}
+
+namespace {
+/// Minimal writer that records the hit energies directly from the buffers
+struct InMemoryWriter {
+  void writeFrame(const podio::Frame& frame, const std::string& category) {
+    if (energies.size() == failAfter) {
+      throw std::runtime_error("Writing failed");
+    }
+    auto* hits = const_cast<podio::CollectionBase*>(frame.getCollectionForWrite("hits"));
+    energies.push_back(hits->getBuffers().dataAsVector<ExampleHitData>()->at(0).energy);
+    categories.push_back(category);
+  }
+
+  void writeFrame(const podio::Frame& frame, const std::string& category,
+                  const std::vector<std::string>& collsToWrite) {
+    writeFrame(frame, category);
+    collections.push_back(collsToWrite);
+  }
+
+  std::vector<double> energies{};
+  std::vector<std::string> categories{};
+  std::vector<std::vector<std::string>> collections{};
+  size_t failAfter{std::numeric_limits<size_t>::max()};
+};
+} // namespace
+
+TEST_CASE("convertFrames", "[frame][convert][multithread]") {
+  auto reader = InMemoryReader(10);
+  auto writer = InMemoryWriter();
+
+  SECTION("All Frames are written in order") {
+    REQUIRE(podio::convertFrames(reader, writer, {}, 3) == 10);
+    REQUIRE(writer.energies == std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    REQUIRE(writer.categories == std::vector<std::string>(10, "events"));
+  }
+
+  SECTION("Exceptions during writing are propagated") {
+    writer.failAfter = 2;
+    REQUIRE_THROWS_AS(podio::convertFrames(reader, writer, {"events"}, 1), std::runtime_error);
+    REQUIRE(writer.energies == std::vector<double>{0, 1});
+  }
+
+  REQUIRE_THROWS_AS(podio::convertFrames(reader, writer, {"events"}, 0), std::invalid_argument);
+}
+
+TEST_CASE("getRelatedCollections", "[frame][skim][relations]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  auto clusters = ExampleClusterCollection();
+  clusters.create(65.).addHits(hits[0]);
+  auto relations = ExampleWithOneRelationCollection();
+  relations.create().cluster(clusters[0]);
+  relations.create(); // one without relation
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  hitRefs.push_back(hits[0]);
+  auto otherHits = ExampleHitCollection();
+  otherHits.create(0xbadULL, 0., 0., 0., 42.);
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  frameData->addCollection<ExampleWithOneRelationData>("relations", relations);
+  frameData->addCollection<ExampleHitData>("hitRefs", hitRefs);
+  frameData->addCollection<ExampleHitData>("otherHits", otherHits);
+  const auto frame = podio::Frame(std::move(frameData));
+
+  REQUIRE(podio::getRelatedCollections(frame, {"relations"}) ==
+          std::vector<std::string>{"relations", "clusters", "hits"});
+  REQUIRE(podio::getRelatedCollections(frame, {"hitRefs", "otherHits"}) ==
+          std::vector<std::string>{"hitRefs", "otherHits", "hits"});
+  REQUIRE(podio::getRelatedCollections(frame, {"hits", "clusters"}) == std::vector<std::string>{"hits", "clusters"});
+  REQUIRE_THROWS_AS(podio::getRelatedCollections(frame, {"nonExistent"}), std::invalid_argument);
+}
+
+TEST_CASE("skimFrames", "[frame][skim]") {
+  auto reader = InMemoryReader(10);
+  auto writer = InMemoryWriter();
+
+  SECTION("Selecting entries") {
+    REQUIRE(podio::skimFrames(reader, writer, "events", std::vector<unsigned>{7, 2, 5}) == 3);
+    REQUIRE(writer.energies == std::vector<double>{7, 2, 5});
+    REQUIRE(writer.collections == std::vector<std::vector<std::string>>(3, {"hits"}));
+
+    REQUIRE_THROWS_AS(podio::skimFrames(reader, writer, "events", std::vector<unsigned>{12}), std::out_of_range);
+  }
+
+  SECTION("Selecting via a predicate") {
+    const auto selector = [](unsigned entry, const podio::GenericParameters&) { return entry % 2 == 0; };
+    REQUIRE(podio::skimFrames(reader, writer, "events", selector, {"hits"}) == 5);
+    REQUIRE(writer.energies == std::vector<double>{0, 2, 4, 6, 8});
+    REQUIRE(writer.categories == std::vector<std::string>(5, "events"));
+  }
+}
+
+TEST_CASE("FrameSummary of FrameData", "[frame][summary]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0x42ULL, 0., 0., 0., 0.);
+  hits.create(0x42ULL, 0., 0., 0., 1.);
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  hitRefs.push_back(hits[1]);
+  auto clusters = ExampleClusterCollection();
+
+  auto frameData = InMemoryFrameData();
+  frameData.addCollection<ExampleHitData>("hits", hits);
+  frameData.addCollection<ExampleHitData>("hitRefs", hitRefs);
+  frameData.addCollection<ExampleClusterData>("clusters", clusters);
+
+  const auto summaries = podio::summarizeFrameData(frameData);
+  REQUIRE(summaries.size() == 3);
+  REQUIRE(summaries[0].name == "clusters");
+  REQUIRE(summaries[0].size == 0);
+  REQUIRE(summaries[1].name == "hitRefs");
+  REQUIRE(summaries[1].isSubset);
+  REQUIRE(summaries[1].size == 1);
+  REQUIRE(summaries[2].name == "hits");
+  REQUIRE(summaries[2].type == "ExampleHitCollection");
+  REQUIRE(summaries[2].id == hits.getID());
+  REQUIRE_FALSE(summaries[2].isSubset);
+  REQUIRE(summaries[2].size == 2);
+}
+
+namespace {
+/// Minimal reader for which the "file name" is the number of entries. Entry i
+/// contains a hit collection with i % 3 hits
+class NumberedEntriesReader {
+public:
+  void openFile(const std::string& filename) {
+    m_nEntries = std::stoul(filename);
+  }
+
+  unsigned getEntries(const std::string&) const {
+    return m_nEntries;
+  }
+
+  std::unique_ptr<InMemoryFrameData> readEntry(const std::string&, unsigned entry) {
+    if (entry >= m_nEntries) {
+      return nullptr;
+    }
+    auto hits = ExampleHitCollection();
+    for (unsigned i = 0; i < entry % 3; ++i) {
+      hits.create();
+    }
+    auto data = std::make_unique<InMemoryFrameData>();
+    data->addCollection<ExampleHitData>("hits", hits);
+    return data;
+  }
+
+private:
+  unsigned m_nEntries{0};
+};
+} // namespace
+
+TEST_CASE("FrameSummary collection size statistics", "[frame][summary][multithread]") {
+  for (const size_t nThreads : {1, 3, 20}) {
+    const auto stats = podio::collectionSizeStats<NumberedEntriesReader>("10", "events", 0, 100, nThreads);
+    REQUIRE(stats.size() == 1);
+    REQUIRE(stats[0].name == "hits");
+    REQUIRE(stats[0].nFrames == 10);
+    REQUIRE(stats[0].total == 9);
+    REQUIRE(stats[0].min == 0);
+    REQUIRE(stats[0].max == 2);
+  }
+
+  const auto stats = podio::collectionSizeStats<NumberedEntriesReader>("10", "events", 4, 6);
+  REQUIRE(stats[0].nFrames == 2);
+  REQUIRE(stats[0].mean() == 1.5);
+
+  REQUIRE(podio::collectionSizeStats<NumberedEntriesReader>("10", "events", 12).empty());
+}
+
+namespace {
+/// FrameData that additionally records I/O statistics like the FrameData of
+/// the readers
+class InMemoryFrameDataWithStats : public InMemoryFrameData {
+public:
+  explicit InMemoryFrameDataWithStats(podio::IOStatsRecorder ioStats) : m_ioStats(std::move(ioStats)) {
+  }
+
+  const podio::IOStatsRecorder& getIOStats() const {
+    return m_ioStats;
+  }
+
+private:
+  podio::IOStatsRecorder m_ioStats{};
+};
+} // namespace
+
+TEST_CASE("IOStats accumulation", "[io-stats]") {
+  auto ioStats = podio::IOStats{};
+  REQUIRE(ioStats.get().empty());
+
+  auto stats = podio::CollectionIOStats{};
+  stats.nEntries = 1;
+  stats.compressedBytes = 10;
+  stats.uncompressedBytes = 20;
+  stats.serializationTime = std::chrono::nanoseconds(100);
+  ioStats.addFrame("events", stats, {{"hits", stats}, {"clusters", stats}});
+  ioStats.add("events", "hits", stats);
+
+  const auto catStats = ioStats.get("events");
+  REQUIRE(catStats.frame.nEntries == 1);
+  REQUIRE(catStats.collections.size() == 2);
+  REQUIRE(catStats.collections.at("hits").nEntries == 2);
+  REQUIRE(catStats.collections.at("hits").compressedBytes == 20);
+  REQUIRE(catStats.collections.at("clusters").uncompressedBytes == 20);
+
+  const auto total = catStats.total();
+  REQUIRE(total.nEntries == 4);
+  REQUIRE(total.compressedBytes == 40);
+  REQUIRE(total.uncompressedBytes == 80);
+  REQUIRE(total.serializationTime == std::chrono::nanoseconds(400));
+
+  REQUIRE(ioStats.get("other_events").collections.empty());
+
+  ioStats.reset();
+  REQUIRE(ioStats.get().empty());
+}
+
+TEST_CASE("Frame records I/O statistics of read collections", "[frame][io-stats]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  auto clusters = ExampleClusterCollection();
+  clusters.create(65.).addHits(hits[0]);
+
+  auto ioStats = std::make_shared<podio::IOStats>();
+  auto frameData = std::make_unique<InMemoryFrameDataWithStats>(podio::IOStatsRecorder(ioStats, "events"));
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+
+  {
+    const auto frame = podio::Frame(std::move(frameData));
+    REQUIRE(ioStats->get().empty());
+
+    const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+    auto catStats = ioStats->get("events");
+    REQUIRE(catStats.collections.size() == 1);
+    REQUIRE(catStats.collections.at("clusters").nEntries == 0);
+    REQUIRE(readClusters[0].Hits(0).energy() == 23.);
+  }
+
+  // Statistics remain accessible after the Frame is gone
+  const auto catStats = ioStats->get("events");
+  REQUIRE(catStats.collections.size() == 2);
+  REQUIRE(catStats.collections.count("hits") == 1);
+  REQUIRE(catStats.total().prepareTime >= catStats.collections.at("clusters").prepareTime);
+
+  // Without a recorder nothing is recorded
+  auto otherData = std::make_unique<InMemoryFrameDataWithStats>(podio::IOStatsRecorder{});
+  otherData->addCollection<ExampleHitData>("hits", hits);
+  const auto frame = podio::Frame(std::move(otherData));
+  REQUIRE(frame.get<ExampleHitCollection>("hits").size() == 1);
+  REQUIRE(ioStats->get("events").collections.size() == 2);
+}
+
+TEST_CASE("Frame memoryUsage", "[frame][memory]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 10; ++i) {
+    hits.create(0xcaffeeULL, 0., 0., 0., double(i));
+  }
+  auto clusters = ExampleClusterCollection();
+  clusters.create(65.).addHits(hits[0]);
+
+  auto frameData = std::make_unique<InMemoryFrameData>();
+  frameData->addCollection<ExampleHitData>("hits", hits);
+  frameData->addCollection<ExampleClusterData>("clusters", clusters);
+  auto frame = podio::Frame(std::move(frameData));
+
+  // Nothing has been unpacked from the raw data yet
+  REQUIRE(frame.getCollectionMemoryUsage().empty());
+  REQUIRE(frame.memoryUsage().total() == 0);
+
+  // Collections retrieved for writing only keep their I/O buffers
+  frame.getCollectionForWrite("hits");
+  auto collUsage = frame.getCollectionMemoryUsage();
+  REQUIRE(collUsage.size() == 1);
+  REQUIRE(collUsage.at("hits").payload == 0);
+  REQUIRE(collUsage.at("hits").ioBuffers >= 10 * sizeof(ExampleHitData));
+
+  // Unpacking creates the objects, while the I/O buffers are kept
+  frame.get("hits");
+  frame.get("clusters");
+  collUsage = frame.getCollectionMemoryUsage();
+  REQUIRE(collUsage.size() == 2);
+  REQUIRE(collUsage.at("hits").payload >= 10 * sizeof(ExampleHitData));
+  REQUIRE(collUsage.at("hits").ioBuffers >= 10 * sizeof(ExampleHitData));
+  REQUIRE(collUsage.at("clusters").relations > 0);
+
+  const auto usage = frame.memoryUsage();
+  REQUIRE(usage.total() == collUsage.at("hits").total() + collUsage.at("clusters").total());
+
+  frame.put(ExampleHitCollection(), "moreHits");
+  REQUIRE(frame.getCollectionMemoryUsage().size() == 3);
+}
+
+namespace {
+/// FrameData that additionally has a policy for the I/O buffers like the
+/// FrameData of the readers
+class InMemoryFrameDataWithPolicy : public InMemoryFrameData {
+public:
+  explicit InMemoryFrameDataWithPolicy(podio::IOBufferPolicy policy) : m_policy(policy) {
+  }
+
+  podio::IOBufferPolicy getIOBufferPolicy() const {
+    return m_policy;
+  }
+
+private:
+  podio::IOBufferPolicy m_policy{podio::IOBufferPolicy::Keep};
+};
+} // namespace
+
+TEST_CASE("Frame releases I/O buffers of unpacked collections", "[frame][memory]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 10; ++i) {
+    hits.create(0xcaffeeULL, 0., 0., 0., double(i));
+  }
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create(65.);
+  cluster.addHits(hits[1]);
+  cluster.addHits(hits[2]);
+
+  const auto makeFrame = [&](podio::IOBufferPolicy policy) {
+    auto frameData = std::make_unique<InMemoryFrameDataWithPolicy>(policy);
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    frameData->addCollection<ExampleClusterData>("clusters", clusters);
+    return podio::Frame(std::move(frameData));
+  };
+
+  const auto keptFrame = makeFrame(podio::IOBufferPolicy::Keep);
+  const auto releasedFrame = makeFrame(podio::IOBufferPolicy::Release);
+
+  const auto& keptHits = keptFrame.get<ExampleHitCollection>("hits");
+  const auto& releasedHits = releasedFrame.get<ExampleHitCollection>("hits");
+  REQUIRE(releasedHits.memoryUsage().ioBuffers < keptHits.memoryUsage().ioBuffers);
+  REQUIRE(releasedHits.memoryUsage().payload == keptHits.memoryUsage().payload);
+  REQUIRE(releasedHits.size() == 10);
+  REQUIRE(releasedHits[3].energy() == 3.);
+  // Only read collections with their buffers still present can expose them
+  REQUIRE(keptHits.hasReadBuffers());
+  REQUIRE_FALSE(releasedHits.hasReadBuffers());
+  REQUIRE_FALSE(hits.hasReadBuffers());
+
+  // Relations still work, since they use the buffers that are not released
+  const auto& releasedClusters = releasedFrame.get<ExampleClusterCollection>("clusters");
+  REQUIRE(releasedClusters[0].Hits_size() == 2);
+  REQUIRE(releasedClusters[0].Hits(1) == releasedHits[2]);
+
+  // Writing re-creates the released buffers, without touching the others
+  for (const auto& name : {"hits", "clusters"}) {
+    auto keptBuffers = const_cast<podio::CollectionBase*>(keptFrame.getCollectionForWrite(name))->getBuffers();
+    auto releasedBuffers =
+        const_cast<podio::CollectionBase*>(releasedFrame.getCollectionForWrite(name))->getBuffers();
+    REQUIRE(releasedBuffers.references->size() == keptBuffers.references->size());
+    for (size_t i = 0; i < keptBuffers.references->size(); ++i) {
+      REQUIRE(*(*releasedBuffers.references)[i] == *(*keptBuffers.references)[i]);
+    }
+  }
+  auto releasedData = const_cast<ExampleHitCollection&>(releasedHits).getBuffers().dataAsVector<ExampleHitData>();
+  auto keptData = const_cast<ExampleHitCollection&>(keptHits).getBuffers().dataAsVector<ExampleHitData>();
+  REQUIRE(releasedData->size() == keptData->size());
+  for (size_t i = 0; i < keptData->size(); ++i) {
+    REQUIRE((*releasedData)[i].energy == (*keptData)[i].energy);
+  }
+  REQUIRE(releasedClusters[0].Hits(0) == releasedHits[1]);
+}
+
+TEST_CASE("Tracing spans of the Frame", "[frame][tracing]") {
+  auto& tracer = podio::Tracer::instance();
+  tracer.clear();
+  REQUIRE_FALSE(tracer.isEnabled());
+
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  const auto makeFrame = [&hits]() {
+    auto frameData = std::make_unique<InMemoryFrameData>();
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    return podio::Frame(std::move(frameData));
+  };
+
+  // Nothing is recorded while tracing is disabled
+  makeFrame().get("hits");
+  REQUIRE(tracer.getSpans().empty());
+
+  tracer.enable();
+  const auto frame = makeFrame();
+  frame.get("hits");
+  frame.get("hits"); // Already unpacked, hence not traced
+  frame.getCollectionForWrite("hits");
+  tracer.enable(false);
+
+  const auto spans = tracer.getSpans();
+  REQUIRE(spans.size() == 4);
+  auto names = std::vector<std::string>{};
+  for (const auto& span : spans) {
+    REQUIRE(span.detail == "hits");
+    REQUIRE(span.duration >= 0);
+    names.emplace_back(span.name);
+  }
+  // Spans are recorded when they end, i.e. nested spans come first
+  REQUIRE(names == std::vector<std::string>{"prepareAfterRead", "setReferences", "Frame::unpack", "prepareForWrite"});
+  REQUIRE(spans[0].start >= spans[2].start);
+  REQUIRE(spans[0].start + spans[0].duration <= spans[2].start + spans[2].duration);
+
+  auto trace = std::ostringstream{};
+  tracer.writeChromeTrace(trace);
+  const auto json = trace.str();
+  REQUIRE(json.find("{\"traceEvents\":[") == 0);
+  REQUIRE(json.find("\"name\":\"Frame::unpack\",\"cat\":\"frame\",\"ph\":\"X\"") != std::string::npos);
+  REQUIRE(json.find("\"args\":{\"detail\":\"hits\"}") != std::string::npos);
+
+  tracer.clear();
+  REQUIRE(tracer.getSpans().empty());
+}
+
+TEST_CASE("Tracer keeps a bounded number of spans per thread", "[tracing][multithread]") {
+  auto& tracer = podio::Tracer::instance();
+  tracer.setCapacity(3);
+  REQUIRE(tracer.capacity() == 3);
+  tracer.enable();
+
+  const auto traceSpans = [](int nSpans) {
+    for (int i = 0; i < nSpans; ++i) {
+      podio::TraceSpan span("span", "test", std::to_string(i));
+    }
+  };
+  traceSpans(5);
+  auto thread = std::thread(traceSpans, 2);
+  thread.join();
+  tracer.enable(false);
+
+  // Only the newest spans of this thread are kept (oldest first), and the spans
+  // of the finished thread are still available
+  auto details = std::vector<std::string>{};
+  for (const auto& span : tracer.getSpans()) {
+    details.emplace_back(span.detail);
+  }
+  REQUIRE(details == std::vector<std::string>{"2", "3", "4", "0", "1"});
+  REQUIRE(tracer.droppedSpans() == 2);
+
+  tracer.setCapacity(podio::Tracer::DefaultCapacity);
+  REQUIRE(tracer.getSpans().empty());
+  REQUIRE(tracer.droppedSpans() == 0);
+}
+
+TEST_CASE("Frame concurrent get of the same collection", "[frame][multithread]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 100; ++i) {
+    hits.create(0xcaffeeULL, 0., 0., 0., double(i));
+  }
+
+  constexpr int nThreads = 4;
+  for (int iFrame = 0; iFrame < 20; ++iFrame) {
+    auto frameData = std::make_unique<InMemoryFrameData>();
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    const auto unpacked = frameData->unpackedCollections();
+    const auto frame = podio::Frame(std::move(frameData));
+
+    // All threads have to get the one unpacked collection, regardless of which
+    // thread actually unpacks it
+    auto collections = std::vector<const podio::CollectionBase*>(nThreads, nullptr);
+    auto threads = std::vector<std::thread>{};
+    for (int i = 0; i < nThreads; ++i) {
+      threads.emplace_back([&frame, &collections, i]() { collections[i] = frame.get("hits"); });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    REQUIRE(*unpacked == std::vector<std::string>{"hits"});
+    for (const auto* coll : collections) {
+      REQUIRE(coll != nullptr);
+      REQUIRE(coll == collections[0]);
+    }
+  }
+}
+
+namespace {
+/// FrameData that fails to hand out the buffers for one collection
+class InMemoryFrameDataWithError : public InMemoryFrameData {
+public:
+  std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name) {
+    if (name == "broken") {
+      throw std::runtime_error("Cannot read broken");
+    }
+    return InMemoryFrameData::getCollectionBuffers(name);
+  }
+};
+} // namespace
+
+TEST_CASE("Frame prefetch", "[frame][prefetch][multithread]") {
+  auto hits = ExampleHitCollection();
+  hits.create(0xcaffeeULL, 0., 0., 0., 23.);
+  hits.create(0xbadULL, 0., 0., 0., 42.);
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create(65.);
+  cluster.addHits(hits[1]);
+
+  const auto makeFrameData = [&]() {
+    auto frameData = std::make_unique<InMemoryFrameDataWithError>();
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    frameData->addCollection<ExampleClusterData>("clusters", clusters);
+    return frameData;
+  };
+  // Collect the tasks to run them later
+  auto tasks = std::vector<std::function<void()>>{};
+  const auto executor = [&tasks](std::function<void()> task) { tasks.emplace_back(std::move(task)); };
+
+  SECTION("Collections are unpacked by the tasks") {
+    auto frameData = makeFrameData();
+    const auto unpacked = frameData->unpackedCollections();
+    const auto frame = podio::Frame(std::move(frameData));
+
+    frame.prefetch({"clusters", "hits", "non-existent"}, executor);
+    REQUIRE(tasks.size() == 3);
+    REQUIRE(unpacked->empty());
+
+    auto threads = std::vector<std::thread>{};
+    for (auto& task : tasks) {
+      threads.emplace_back(std::move(task));
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    auto unpackedNames = *unpacked;
+    std::sort(unpackedNames.begin(), unpackedNames.end());
+    REQUIRE(unpackedNames == std::vector<std::string>{"clusters", "hits"});
+
+    const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+    const auto& readHits = frame.get<ExampleHitCollection>("hits");
+    REQUIRE(readClusters[0].energy() == 65.);
+    REQUIRE(readClusters[0].Hits(0) == readHits[1]);
+    REQUIRE(frame.get("non-existent") == nullptr);
+    REQUIRE(unpacked->size() == 2);
+  }
+
+  SECTION("Collections are unpacked concurrently to get") {
+    auto frameData = makeFrameData();
+    const auto unpacked = frameData->unpackedCollections();
+    const auto frame = podio::Frame(std::move(frameData));
+
+    auto threads = std::vector<std::thread>{};
+    frame.prefetch({"hits", "clusters"},
+                   [&threads](std::function<void()> task) { threads.emplace_back(std::move(task)); });
+    const auto& readClusters = frame.get<ExampleClusterCollection>("clusters");
+    const auto& readHits = frame.get<ExampleHitCollection>("hits");
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    REQUIRE(unpacked->size() == 2);
+    REQUIRE(readHits.size() == 2);
+    REQUIRE(readClusters[0].Hits(0) == readHits[1]);
+  }
+
+  SECTION("Exceptions are rethrown by get") {
+    const auto frame = podio::Frame(makeFrameData());
+    frame.prefetch({"broken"}, executor);
+    REQUIRE_NOTHROW(tasks[0]());
+    REQUIRE_THROWS_AS(frame.get("broken"), std::runtime_error);
+    REQUIRE_THROWS_AS(frame.get("broken"), std::runtime_error);
+    REQUIRE(frame.get<ExampleHitCollection>("hits").size() == 2);
+  }
+
+  SECTION("Tasks do nothing once the Frame is gone") {
+    auto frameData = makeFrameData();
+    const auto unpacked = frameData->unpackedCollections();
+    {
+      const auto frame = podio::Frame(std::move(frameData));
+      frame.prefetch({"hits"}, executor);
+    }
+    tasks[0]();
+    REQUIRE(unpacked->empty());
+  }
+}
+
+namespace {
+/// FrameData that takes a while to hand out the buffers, such that other
+/// threads try to get the same collection in the meantime
+class SlowInMemoryFrameData : public InMemoryFrameData {
+public:
+  std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return InMemoryFrameData::getCollectionBuffers(name);
+  }
+};
+} // namespace
+
+TEST_CASE("Frame concurrent getCollectionForWrite of the same collection", "[frame][multithread]") {
+  auto hits = ExampleHitCollection();
+  for (int i = 0; i < 10; ++i) {
+    hits.create(0xcaffeeULL, 0., 0., 0., double(i));
+  }
+  const auto makeFrame = [&hits]() {
+    auto frameData = std::make_unique<SlowInMemoryFrameData>();
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    return podio::Frame(std::move(frameData));
+  };
+
+  // Start getting the collection for writing on another thread, and give it
+  // some time to start retrieving the buffers
+  const auto startGetForWrite = [](const podio::Frame& frame, const podio::CollectionBase*& coll) {
+    auto thread = std::thread([&frame, &coll]() { coll = frame.getCollectionForWrite("hits"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return thread;
+  };
+
+  SECTION("Getting the collection while it is created for writing") {
+    const auto frame = makeFrame();
+    const podio::CollectionBase* forWrite = nullptr;
+    auto thread = startGetForWrite(frame, forWrite);
+    const auto& readHits = frame.get<ExampleHitCollection>("hits");
+    thread.join();
+
+    REQUIRE(readHits.size() == 10);
+    REQUIRE(readHits[3].energy() == 3.);
+    REQUIRE(forWrite == &readHits);
+  }
+
+  SECTION("Getting the collection for writing on two threads") {
+    const auto frame = makeFrame();
+    const podio::CollectionBase* forWrite = nullptr;
+    auto thread = startGetForWrite(frame, forWrite);
+    const auto* otherForWrite = frame.getCollectionForWrite("hits");
+    thread.join();
+
+    REQUIRE(forWrite != nullptr);
+    REQUIRE(otherForWrite == forWrite);
+    // The collection has not been unpacked, but that can still happen
+    const auto& readHits = frame.get<ExampleHitCollection>("hits");
+    REQUIRE(&readHits == forWrite);
+    REQUIRE(readHits.size() == 10);
+  }
+}
+
+TEST_CASE("Frame concurrent lazy resolution of relations", "[frame][multithread]") {
+  auto hits = ExampleHitCollection();
+  auto innerClusters = ExampleClusterCollection();
+  auto outerClusters = ExampleClusterCollection();
+  for (int i = 0; i < 4; ++i) {
+    auto hit = hits.create(0xcaffeeULL, 0., 0., 0., double(i));
+    auto inner = innerClusters.create(double(i));
+    inner.addHits(hit);
+    auto outer = outerClusters.create(double(i));
+    outer.addClusters(inner);
+  }
+
+  for (int iFrame = 0; iFrame < 5; ++iFrame) {
+    auto frameData = std::make_unique<SlowInMemoryFrameData>();
+    frameData->addCollection<ExampleHitData>("hits", hits);
+    frameData->addCollection<ExampleClusterData>("innerClusters", innerClusters);
+    frameData->addCollection<ExampleClusterData>("outerClusters", outerClusters);
+    const auto frame = podio::Frame(std::move(frameData));
+    const auto& outer = frame.get<ExampleClusterCollection>("outerClusters");
+
+    // Every thread triggers the unpacking of the inner clusters by resolving a
+    // relation. Regardless of which thread wins, the relations of the inner
+    // clusters have to be resolvable afterwards
+    auto energies = std::vector<double>(outer.size(), -1.);
+    auto threads = std::vector<std::thread>{};
+    for (size_t i = 0; i < outer.size(); ++i) {
+      threads.emplace_back([&outer, &energies, i]() {
+        const auto inner = outer[i].Clusters(0);
+        if (inner.Hits_size() == 1) {
+          energies[i] = inner.Hits(0).energy();
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    REQUIRE(energies == std::vector<double>{0., 1., 2., 3.});
+  }
+}
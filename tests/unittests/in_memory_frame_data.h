@@ -0,0 +1,98 @@
+#ifndef PODIO_TESTS_UNITTESTS_IN_MEMORY_FRAME_DATA_H // NOLINT(llvm-header-guard): folder structure not suitable
+#define PODIO_TESTS_UNITTESTS_IN_MEMORY_FRAME_DATA_H // NOLINT(llvm-header-guard): folder structure not suitable
+
+#include "podio/CollectionBufferFactory.h"
+#include "podio/CollectionBuffers.h"
+#include "podio/CollectionIDTable.h"
+#include "podio/GenericParameters.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal FrameData that hands out copies of the I/O buffers of collections
+ * that have been added to it. This makes it possible to test the unpacking
+ * functionality of the Frame without going through an actual I/O backend.
+ *
+ * NOTE: Only collections without vector members are supported.
+ */
+class InMemoryFrameData {
+public:
+  InMemoryFrameData() = default;
+  InMemoryFrameData(const InMemoryFrameData&) = delete;
+  InMemoryFrameData& operator=(const InMemoryFrameData&) = delete;
+  InMemoryFrameData(InMemoryFrameData&&) = default;
+  InMemoryFrameData& operator=(InMemoryFrameData&&) = default;
+
+  ~InMemoryFrameData() {
+    for (auto& [name, buffers] : m_buffers) {
+      buffers.deleteBuffers(buffers);
+    }
+  }
+
+  /// Add a collection by copying its buffers after preparing it for writing.
+  /// Collections have to be added in an order that makes sure that all
+  /// referenced collections have been added (and hence have an ID) before
+  template <typename DataT, typename CollT>
+  void addCollection(const std::string& name, CollT& coll) {
+    coll.setID(m_idTable.add(name));
+    coll.prepareForWrite();
+    auto writeBuffers = coll.getBuffers();
+
+    auto readBuffers = podio::CollectionBufferFactory::instance()
+                           .createBuffers(std::string(coll.getTypeName()), coll.getSchemaVersion(),
+                                          coll.isSubsetCollection())
+                           .value();
+    if (!coll.isSubsetCollection()) {
+      *readBuffers.template dataAsVector<DataT>() = *writeBuffers.template dataAsVector<DataT>();
+    }
+    for (size_t i = 0; i < readBuffers.references->size(); ++i) {
+      *(*readBuffers.references)[i] = *(*writeBuffers.references)[i];
+    }
+    m_buffers.emplace(name, std::move(readBuffers));
+  }
+
+  std::optional<podio::CollectionReadBuffers> getCollectionBuffers(const std::string& name) {
+    const auto it = m_buffers.find(name);
+    if (it == m_buffers.end()) {
+      return std::nullopt;
+    }
+    auto buffers = std::move(it->second);
+    m_buffers.erase(it);
+    m_unpacked->push_back(name);
+    return buffers;
+  }
+
+  podio::CollectionIDTable getIDTable() const {
+    return {m_idTable.ids(), m_idTable.names()};
+  }
+
+  std::vector<std::string> getAvailableCollections() const {
+    std::vector<std::string> collections;
+    for (const auto& [name, _] : m_buffers) {
+      collections.push_back(name);
+    }
+    return collections;
+  }
+
+  std::unique_ptr<podio::GenericParameters> getParameters() {
+    return std::make_unique<podio::GenericParameters>();
+  }
+
+  /// The names of all collections that have been requested by the Frame so far
+  /// (in the order in which they have been requested). Remains usable after
+  /// this has been handed over to the Frame
+  std::shared_ptr<const std::vector<std::string>> unpackedCollections() const {
+    return m_unpacked;
+  }
+
+private:
+  podio::CollectionIDTable m_idTable{};
+  std::map<std::string, podio::CollectionReadBuffers> m_buffers{};
+  std::shared_ptr<std::vector<std::string>> m_unpacked{std::make_shared<std::vector<std::string>>()};
+};
+
+#endif // PODIO_TESTS_UNITTESTS_IN_MEMORY_FRAME_DATA_H
@@ -6,10 +6,12 @@
 #include "datamodel/EnergyInNamespaceCollection.h"
 #include "datamodel/ExampleClusterCollection.h"
 #include "datamodel/ExampleHitCollection.h"
+#include "datamodel/ExampleMCCollection.h"
 #include "datamodel/TypeWithEnergy.h"
 
 #include <map>
 #include <stdexcept>
+#include <vector>
 
 TEST_CASE("InterfaceTypes basic functionality", "[interface-types][basics]") {
   using WrapperT = TypeWithEnergy;
@@ -112,3 +114,41 @@ TEST_CASE("InterfaceType getters", "[basics][interface-types][code-gen]") {
   TypeWithEnergy interfaceType = cluster;
   REQUIRE(interfaceType.energy() == 3.14f);
 }
+
+TEST_CASE("InterfaceType dispatch", "[basics][interface-types]") {
+  ExampleHitCollection hits{};
+  hits.create(0xcaffeeULL, 0., 0., 0., 1.);
+  auto mcParticle = MutableExampleMC{};
+  mcParticle.energy(2.);
+  mcParticle.PDG(11);
+  auto cluster = MutableExampleCluster{};
+  cluster.energy(3.);
+
+  auto wrappers = std::vector<TypeWithEnergy>{hits[0], mcParticle, cluster};
+  // Copies refer to the same objects
+  const auto copies = wrappers;
+  for (size_t i = 0; i < wrappers.size(); ++i) {
+    REQUIRE(copies[i] == wrappers[i]);
+  }
+  REQUIRE(copies[1].isA<ExampleMC>());
+  REQUIRE(copies[1].getValue<ExampleMC>() == mcParticle);
+
+  double totalEnergy = 0;
+  for (const auto& w : copies) {
+    REQUIRE(w.isAvailable());
+    totalEnergy += w.energy();
+  }
+  REQUIRE(totalEnergy == 6.);
+
+  ex42::AnotherTypeWithEnergy another = mcParticle;
+  REQUIRE(another.PDG() == 11);
+  REQUIRE(another.energy() == 2.);
+  another = nsp::EnergyInNamespace{};
+  REQUIRE(another.PDG() == 42);
+
+  // Unlinking only affects the unlinked copy
+  wrappers[2].unlink();
+  REQUIRE_FALSE(wrappers[2].isAvailable());
+  REQUIRE(copies[2].isAvailable());
+  REQUIRE(wrappers[2] != copies[2]);
+}
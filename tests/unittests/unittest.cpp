@@ -1,6 +1,10 @@
 // STL
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <map>
+#include <numeric>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
@@ -18,6 +22,7 @@
 #include "podio/ROOTReader.h"
 #include "podio/ROOTWriter.h"
 #include "podio/podioVersion.h"
+#include "podio/utilities/ParametersAsJSON.h"
 
 #ifndef PODIO_ENABLE_SIO
   #define PODIO_ENABLE_SIO 0
@@ -48,6 +53,7 @@
 #include "datamodel/MutableExampleWithArray.h"
 #include "datamodel/MutableExampleWithComponent.h"
 #include "podio/UserDataCollection.h"
+#include "podio/UserDataTable.h"
 
 TEST_CASE("AutoDelete", "[basics][memory-management]") {
   auto coll = EventInfoCollection();
@@ -254,6 +260,42 @@ TEST_CASE("Referencing", "[basics][relations]") {
   }
 }
 
+TEST_CASE("RelationRange random access", "[basics][relations]") {
+  auto hits = ExampleHitCollection();
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create();
+  for (int i = 0; i < 5; ++i) {
+    cluster.addHits(hits.create(0x42ULL, 0., 0., 0., double(i)));
+  }
+
+  const auto range = cluster.Hits();
+  // Dereferencing returns by value, hence only an input iterator before c++20
+  using IteratorT = decltype(range.begin());
+  STATIC_REQUIRE(std::is_same_v<std::iterator_traits<IteratorT>::iterator_category, std::input_iterator_tag>);
+#if __cplusplus >= 202002L
+  STATIC_REQUIRE(std::random_access_iterator<IteratorT>);
+#endif
+  REQUIRE(range.end() - range.begin() == 5);
+  REQUIRE((range.begin() + 3)->energy() == 3);
+  REQUIRE(range.begin()[4] == hits[4]);
+  REQUIRE(*(range.end() - 2) == hits[3]);
+  REQUIRE(range.begin() < range.end());
+
+  const auto reverse = std::vector<ExampleHit>(std::make_reverse_iterator(range.end()),
+                                               std::make_reverse_iterator(range.begin()));
+  REQUIRE(reverse.front() == hits[4]);
+
+  const auto maxHit = std::max_element(range.begin(), range.end(),
+                                       [](const auto& a, const auto& b) { return a.energy() < b.energy(); });
+  REQUIRE(maxHit - range.begin() == 4);
+
+  const auto energies = range.project(&ExampleHit::energy);
+  REQUIRE(energies == std::vector<double>{0, 1, 2, 3, 4});
+  REQUIRE(std::accumulate(energies.begin(), energies.end(), 0.) == 10);
+  const auto cellIDs = range.project([](const auto& h) { return h.cellID(); });
+  REQUIRE(cellIDs.size() == 5);
+}
+
 TEST_CASE("VariadicCreate", "[basics]") {
   // Test that objects created via the variadic create template function handle relations correctly
   auto clusters = ExampleClusterCollection();
@@ -290,6 +332,50 @@ TEST_CASE("write_buffer", "[basics][io]") {
   REQUIRE_NOTHROW(ref_coll.prepareForWrite());
 }
 
+TEST_CASE("write_buffer relations and vector members", "[basics][io][relations]") {
+  auto hits = ExampleHitCollection();
+  hits.setID(42);
+  for (int i = 0; i < 4; ++i) {
+    hits.create(0x42ULL, 0., 0., 0., double(i));
+  }
+  auto clusters = ExampleClusterCollection();
+  clusters.create().addHits(hits[1]);
+  clusters.create(); // no relations
+  auto cluster = clusters.create();
+  cluster.addHits(hits[3]);
+  cluster.addHits(hits[0]);
+
+  clusters.prepareForWrite();
+  auto buffers = clusters.getBuffers();
+  const auto& data = *buffers.dataAsVector<ExampleClusterData>();
+  REQUIRE(data[0].Hits_begin == 0);
+  REQUIRE(data[0].Hits_end == 1);
+  REQUIRE(data[1].Hits_begin == 1);
+  REQUIRE(data[1].Hits_end == 1);
+  REQUIRE(data[2].Hits_begin == 1);
+  REQUIRE(data[2].Hits_end == 3);
+  const auto& hitIDs = *(*buffers.references)[0];
+  REQUIRE(hitIDs == std::vector<podio::ObjectID>{{1, 42}, {3, 42}, {0, 42}});
+
+  auto vecMems = ExampleWithVectorMemberCollection();
+  vecMems.create().addcount(1);
+  auto vecMem = vecMems.create();
+  vecMem.addcount(2);
+  vecMem.addcount(3);
+  vecMems.prepareForWrite();
+  auto vecBuffers = vecMems.getBuffers();
+  const auto& vecData = *vecBuffers.dataAsVector<ExampleWithVectorMemberData>();
+  REQUIRE(vecData[1].count_begin == 1);
+  REQUIRE(vecData[1].count_end == 3);
+  const auto* counts = podio::CollectionWriteBuffers::asVector<int>((*vecBuffers.vectorMembers)[0].second);
+  REQUIRE(*counts == std::vector<int>{1, 2, 3});
+
+  // Relations to objects that are not part of any collection cannot be written
+  auto untrackedRels = ExampleClusterCollection();
+  untrackedRels.create().addHits(ExampleHit{});
+  REQUIRE_THROWS_AS(untrackedRels.prepareForWrite(), std::runtime_error);
+}
+
 TEST_CASE("thread-safe prepareForWrite", "[basics][multithread]") {
   // setup a collection that we can then prepareForWrite from multiple threads
   constexpr auto nElements = 100u;
@@ -350,6 +436,134 @@ TEST_CASE("UserDataCollection print", "[basics]") {
   REQUIRE(sstr.str() == "[1, 2, 3]");
 }
 
+TEST_CASE("UserDataCollection external memory", "[basics]") {
+  SECTION("Adopting memory") {
+    bool deleted = false;
+    auto* values = new float[4]{1.f, 2.f, 3.f, 4.f};
+    {
+      auto coll = podio::UserDataCollection<float>(values, 4, [&deleted](float* ptr) {
+        delete[] ptr;
+        deleted = true;
+      });
+      REQUIRE(coll.isExternal());
+      REQUIRE(coll.size() == 4);
+      REQUIRE(coll.data() == values);
+      REQUIRE(coll[2] == 3.f);
+      REQUIRE(std::accumulate(coll.begin(), coll.end(), 0.f) == 10.f);
+
+      auto movedColl = std::move(coll);
+      REQUIRE(movedColl.data() == values);
+      REQUIRE_FALSE(deleted);
+    }
+    REQUIRE(deleted);
+  }
+
+  SECTION("Borrowing memory") {
+    auto values = std::vector<int32_t>{1, 2, 3};
+    auto coll = podio::UserDataCollection<int32_t>(values.data(), values.size());
+    coll[0] = 42;
+    REQUIRE(values[0] == 42);
+
+    std::stringstream sstr;
+    coll.print(sstr);
+    REQUIRE(sstr.str() == "[42, 2, 3]");
+
+    // Memory is only copied when it has to be owned
+    coll.push_back(4);
+    REQUIRE_FALSE(coll.isExternal());
+    REQUIRE(coll.size() == 4);
+    coll[1] = 0;
+    REQUIRE(values == std::vector<int32_t>{42, 2, 3});
+  }
+
+  SECTION("Writing") {
+    auto values = std::vector<double>{1., 2., 3.};
+    auto coll = podio::UserDataCollection<double>(values.data(), values.size());
+    coll.prepareForWrite();
+    auto buffers = coll.getBuffers();
+    REQUIRE(*podio::CollectionWriteBuffers::asVector<double>(buffers.data) == values);
+
+    // Changes after writing are picked up in the next write
+    coll[1] = 42.;
+    coll.prepareForWrite();
+    buffers = coll.getBuffers();
+    REQUIRE((*podio::CollectionWriteBuffers::asVector<double>(buffers.data))[1] == 42.);
+
+    // Changes that bypass the collection are not picked up once prepared
+    values[2] = 23.;
+    auto movedColl = std::move(coll);
+    movedColl.prepareForWrite();
+    buffers = movedColl.getBuffers();
+    REQUIRE(*podio::CollectionWriteBuffers::asVector<double>(buffers.data) == std::vector<double>{1., 42., 3.});
+  }
+
+  SECTION("Adopting requires a deleter") {
+    auto values = std::vector<float>{1.f, 2.f};
+    REQUIRE_THROWS_AS(podio::UserDataCollection<float>(values.data(), values.size(),
+                                                       podio::UserDataCollection<float>::DeleterT{}),
+                      std::invalid_argument);
+    // Without memory there is nothing to delete
+    const auto coll = podio::UserDataCollection<float>(nullptr, 0, podio::UserDataCollection<float>::DeleterT{});
+    REQUIRE(coll.empty());
+  }
+}
+
+TEST_CASE("UserDataTable", "[basics]") {
+  auto table = podio::UserDataTable<float>({"energy", "time"});
+  REQUIRE(table.numColumns() == 2);
+  REQUIRE(table.empty());
+
+  table.push_back({1.f, 10.f});
+  table.push_back(std::vector<float>{2.f, 20.f});
+  REQUIRE(table.size() == 2);
+  REQUIRE_THROWS_AS(table.push_back({3.f}), std::invalid_argument);
+
+  const auto energies = table.column("energy");
+  REQUIRE(energies.size() == 2);
+  REQUIRE(energies[1] == 2.f);
+  REQUIRE(std::accumulate(table.column(1).begin(), table.column(1).end(), 0.f) == 30.f);
+  REQUIRE_THROWS_AS(table.column("charge"), std::out_of_range);
+
+  table.column("time")[0] = 5.f;
+  REQUIRE(table.addColumn("charge") == 2);
+  REQUIRE_THROWS_AS(table.addColumn("charge"), std::invalid_argument);
+  REQUIRE(table.column("charge").size() == 2);
+
+  std::stringstream sstr;
+  table.print(sstr);
+  REQUIRE(sstr.str() == "{energy: [1, 2], time: [5, 20], charge: [0, 0]}");
+
+  SECTION("Round trip through I/O buffers") {
+    table.prepareForWrite();
+    auto writeBuffers = table.getBuffers();
+    const auto& values = *writeBuffers.dataAsVector<float>();
+    REQUIRE(values == std::vector<float>{1.f, 2.f, 5.f, 20.f, 0.f, 0.f});
+    REQUIRE(writeBuffers.vectorMembers->size() == 1);
+    const auto& names = *podio::CollectionWriteBuffers::asVector<std::string>((*writeBuffers.vectorMembers)[0].second);
+    REQUIRE(names == table.columnNames());
+
+    auto readBuffers =
+        podio::CollectionBufferFactory::instance().createBuffers(std::string(table.getTypeName()), 1, false).value();
+    *readBuffers.dataAsVector<float>() = values;
+    *podio::CollectionReadBuffers::asVector<std::string>((*readBuffers.vectorMembers)[0].second) = names;
+    auto readColl = readBuffers.createCollection(readBuffers, false);
+    const auto& readTable = dynamic_cast<const podio::UserDataTable<float>&>(*readColl);
+    REQUIRE(readTable.size() == 2);
+    REQUIRE(readTable.columnNames() == table.columnNames());
+    REQUIRE(readTable.column("time")[0] == 5.f);
+  }
+
+  SECTION("Moving keeps the prepared state") {
+    table.prepareForWrite();
+    auto moved = std::move(table);
+    REQUIRE(moved.size() == 2);
+    REQUIRE(*moved.getBuffers().dataAsVector<float>() == std::vector<float>{1.f, 2.f, 5.f, 20.f, 0.f, 0.f});
+    // Modifying the moved to table invalidates the prepared buffers
+    moved.column("charge")[1] = 3.f;
+    REQUIRE(moved.getBuffers().dataAsVector<float>()->back() == 3.f);
+  }
+}
+
 /*
 TEST_CASE("Arrays") {
   auto obj = ExampleWithArray();
@@ -482,6 +696,56 @@ TEST_CASE("Collection size and empty", "[basics][collections]") {
   REQUIRE(coll.size() == 2u);
 }
 
+TEST_CASE("Collection memoryUsage", "[basics][collections][memory]") {
+  auto hits = ExampleHitCollection();
+  const auto emptyUsage = hits.memoryUsage();
+  REQUIRE(emptyUsage.payload == 0);
+  REQUIRE(emptyUsage.relations == 0);
+
+  for (int i = 0; i < 100; ++i) {
+    hits.create();
+  }
+  auto usage = hits.memoryUsage();
+  REQUIRE(usage.payload >= 100 * sizeof(ExampleHitData));
+  REQUIRE(usage.relations == 0);
+  REQUIRE(usage.total() == usage.payload + usage.ioBuffers);
+
+  // Preparing for writing fills the I/O buffers
+  hits.prepareForWrite();
+  REQUIRE(hits.memoryUsage().payload == usage.payload);
+  REQUIRE(hits.memoryUsage().ioBuffers >= usage.ioBuffers + 100 * sizeof(ExampleHitData));
+
+  auto clusters = ExampleClusterCollection();
+  auto cluster = clusters.create();
+  for (const auto hit : hits) {
+    cluster.addHits(hit);
+  }
+  REQUIRE(clusters.memoryUsage().relations >= 100 * sizeof(ExampleHit));
+
+  auto vecMems = ExampleWithVectorMemberCollection();
+  const auto vecMemPayload = vecMems.memoryUsage().payload;
+  auto vecMem = vecMems.create();
+  for (int i = 0; i < 100; ++i) {
+    vecMem.addcount(i);
+  }
+  REQUIRE(vecMems.memoryUsage().payload >= vecMemPayload + 100 * sizeof(int));
+
+  // Subset collections do not own their objects
+  auto hitRefs = ExampleHitCollection();
+  hitRefs.setSubsetCollection();
+  for (const auto hit : hits) {
+    hitRefs.push_back(hit);
+  }
+  REQUIRE(hitRefs.memoryUsage().payload < 100 * sizeof(ExampleHitData));
+
+  auto userData = podio::UserDataCollection<double>();
+  userData.resize(100);
+  REQUIRE(userData.memoryUsage().payload >= 100 * sizeof(double));
+
+  const auto sum = usage + clusters.memoryUsage();
+  REQUIRE(sum.total() == usage.total() + clusters.memoryUsage().total());
+}
+
 TEST_CASE("const correct indexed access to const collections", "[const-correctness]") {
   STATIC_REQUIRE(std::is_same_v<decltype(std::declval<const ExampleClusterCollection>()[0]),
                                 ExampleCluster>); // const collections should only have indexed access to mutable
@@ -1085,6 +1349,20 @@ TEST_CASE("GenericParameters constructors", "[generic-parameters]") {
   }
 }
 
+TEST_CASE("GenericParameters as JSON", "[generic-parameters]") {
+  auto params = podio::GenericParameters{};
+  REQUIRE(podio::utils::parametersAsJSON(params) == "[]");
+
+  params.setValue("value", 42);
+  params.setValue("value", std::string("with \"quotes\"\n"));
+  params.setValue("floats", {0.5f, 1.25f});
+  params.setValue("empty", std::vector<double>{});
+
+  REQUIRE(podio::utils::parametersAsJSON(params) ==
+          R"([["value","int",[42]],["floats","float",[0.5,1.25]],)"
+          R"(["value","std::string",["with \"quotes\"\u000a"]],["empty","double",[]]])");
+}
+
 // Helper alias template "macro" to get the return type of calling
 // GenericParameters::getValue with the desired template type
 template <typename T>
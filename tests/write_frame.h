@@ -21,6 +21,7 @@
 
 #include "podio/Frame.h"
 #include "podio/UserDataCollection.h"
+#include "podio/UserDataTable.h"
 
 #include <string>
 #include <tuple>
@@ -283,6 +284,14 @@ auto createUserDataCollections(int i) {
   return retType;
 }
 
+auto createUserDataTable(int i) {
+  auto table = podio::UserDataTable<float>({"energy", "time"});
+  for (int row = 0; row < i + 2; ++row) {
+    table.push_back({row * 1.5f, i + row * 0.5f});
+  }
+  return table;
+}
+
 auto createNamespaceRelationCollection(int i) {
   auto retVal = std::tuple<ex42::ExampleWithNamespaceCollection, ex42::ExampleWithARelationCollection,
                            ex42::ExampleWithARelationCollection>{};
@@ -393,6 +402,7 @@ podio::Frame makeFrame(int iFrame) {
   auto [usrInts, usrDoubles] = createUserDataCollections(iFrame);
   frame.put(std::move(usrInts), "userInts");
   frame.put(std::move(usrDoubles), "userDoubles");
+  frame.put(createUserDataTable(iFrame), "userTable");
 
   auto [namesps, namespsrels, cpytest] = createNamespaceRelationCollection(iFrame);
   frame.put(std::move(namesps), "WithNamespaceMember");
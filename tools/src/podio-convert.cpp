@@ -0,0 +1,146 @@
+#include "podio/FrameConverter.h"
+
+#include "podioToolsIO.h"
+
+#include "TROOT.h"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+using podio::tools::Format;
+
+struct Args {
+  std::string inputFile{};
+  std::string outputFile{};
+  std::optional<Format> outputFormat{};
+  std::optional<int> compression{};
+  std::vector<std::string> categories{};
+  int nThreads{1};
+};
+
+void printUsage(std::ostream& os) {
+  os << "usage: podio-convert [-h] [-f {root,rntuple,sio}] [-c COMPRESSION] [-j THREADS]\n"
+        "                     [--category CATEGORY] INPUT OUTPUT\n\n"
+        "Convert a podio file to another backend (or compression). The input format is\n"
+        "determined from the input file. The buffers of all collections are written\n"
+        "as they have been read, i.e. without unpacking the collections.\n\n"
+        "positional arguments:\n"
+        "  INPUT                 the input file\n"
+        "  OUTPUT                the output file\n\n"
+        "options:\n"
+        "  -h, --help            show this help message and exit\n"
+        "  -f, --format FORMAT   the output format: root (TTree based), rntuple or sio.\n"
+        "                        Determined from the output file extension by default,\n"
+        "                        where .root files are TTree based\n"
+        "  -c, --compression N   the compression settings of the output file. The ROOT\n"
+        "                        compression settings (algorithm * 100 + level) for\n"
+        "                        root and rntuple, the zlib level (0 - 9) for sio\n"
+        "  -j, --threads N       the number of threads ROOT uses for (de)compressing the\n"
+        "                        data in addition to the reading thread\n"
+        "  --category CATEGORY   only convert the Frames of this category. Can be given\n"
+        "                        more than once. All categories are converted by default\n";
+}
+
+std::optional<Args> parseArgs(int argc, char* argv[]) {
+  Args args{};
+  std::vector<std::string> positional{};
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      printUsage(std::cout);
+      std::exit(0);
+    }
+
+    if (arg == "-f" || arg == "--format" || arg == "-c" || arg == "--compression" || arg == "-j" ||
+        arg == "--threads" || arg == "--category") {
+      if (++i == argc) {
+        std::cerr << "podio-convert: " << arg << " requires an argument\n";
+        return std::nullopt;
+      }
+      const std::string value = argv[i];
+      try {
+        if (arg == "-f" || arg == "--format") {
+          args.outputFormat = podio::tools::parseFormat(value);
+          if (!args.outputFormat) {
+            std::cerr << "podio-convert: invalid format '" << value << "'\n";
+            return std::nullopt;
+          }
+        } else if (arg == "-c" || arg == "--compression") {
+          args.compression = std::stoi(value);
+        } else if (arg == "-j" || arg == "--threads") {
+          args.nThreads = std::stoi(value);
+        } else {
+          args.categories.emplace_back(value);
+        }
+      } catch (const std::logic_error&) {
+        std::cerr << "podio-convert: invalid value '" << value << "' for " << arg << "\n";
+        return std::nullopt;
+      }
+    } else if (!arg.empty() && arg.front() == '-') {
+      std::cerr << "podio-convert: unrecognized argument " << arg << "\n";
+      return std::nullopt;
+    } else {
+      positional.emplace_back(arg);
+    }
+  }
+
+  if (positional.size() != 2) {
+    return std::nullopt;
+  }
+  args.inputFile = positional[0];
+  args.outputFile = positional[1];
+
+  if (!args.outputFormat) {
+    args.outputFormat = podio::tools::getOutputFormat(args.outputFile);
+    if (!args.outputFormat) {
+      std::cerr << "podio-convert: Cannot determine the format for output file " << args.outputFile << "\n";
+      return std::nullopt;
+    }
+  }
+
+  return args;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+  const auto args = parseArgs(argc, argv);
+  if (!args) {
+    printUsage(std::cerr);
+    return 1;
+  }
+
+  try {
+    const auto inputFormat = podio::tools::getInputFormat(args->inputFile);
+    if (!inputFormat) {
+      std::cerr << "podio-convert: Cannot determine the format of input file " << args->inputFile << "\n";
+      return 1;
+    }
+
+    // The Frames are read on a background thread while they are written
+    ROOT::EnableThreadSafety();
+    if (args->nThreads > 1) {
+      ROOT::EnableImplicitMT(args->nThreads);
+    }
+
+    const auto convert = [&](auto& reader) {
+      const auto write = [&](auto& writer) { return podio::convertFrames(reader, writer, args->categories); };
+      return podio::tools::withWriter(args->outputFormat.value(), args->outputFile, args->compression, write);
+    };
+    const auto nFrames = podio::tools::withReader(inputFormat.value(), args->inputFile, convert);
+    std::cout << "podio-convert: Converted " << nFrames << " Frames from " << args->inputFile << " to "
+              << args->outputFile << "\n";
+  } catch (const std::exception& ex) {
+    std::cerr << "podio-convert: " << ex.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+#include "podio/ROOTFileMerger.h"
+
+#ifndef PODIO_ENABLE_SIO
+  #define PODIO_ENABLE_SIO 0
+#endif
+#if PODIO_ENABLE_SIO
+  #include "podio/SIOFileMerger.h"
+#endif
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+void printUsage(std::ostream& os) {
+  os << "usage: podio-merge [-h] [--no-fast-clone] -o OUTPUT INPUT [INPUT ...]\n\n"
+        "Merge several podio files into one. The backend is determined from the\n"
+        "file extension (.root or .sio).\n\n"
+        "ROOT files (written with the ROOTWriter) are merged by fast cloning the\n"
+        "compressed baskets if all inputs have the same collections in all\n"
+        "categories, otherwise all Frames are read and written again. SIO files\n"
+        "are merged by copying the compressed records.\n\n"
+        "options:\n"
+        "  -h, --help            show this help message and exit\n"
+        "  -o, --output OUTPUT   the output file\n"
+        "  --no-fast-clone       always read and write all Frames for ROOT files\n";
+}
+
+bool endsWith(std::string_view str, std::string_view suffix) {
+  return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::string outputFile{};
+  std::vector<std::string> inputFiles{};
+  bool fastClone = true;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      printUsage(std::cout);
+      return 0;
+    } else if (arg == "-o" || arg == "--output") {
+      if (++i == argc) {
+        std::cerr << "podio-merge: " << arg << " requires an argument\n";
+        return 1;
+      }
+      outputFile = argv[i];
+    } else if (arg == "--no-fast-clone") {
+      fastClone = false;
+    } else if (!arg.empty() && arg.front() == '-') {
+      std::cerr << "podio-merge: unrecognized argument " << arg << "\n";
+      printUsage(std::cerr);
+      return 1;
+    } else {
+      inputFiles.emplace_back(arg);
+    }
+  }
+
+  if (outputFile.empty() || inputFiles.empty()) {
+    printUsage(std::cerr);
+    return 1;
+  }
+
+  try {
+    if (endsWith(outputFile, ".root")) {
+      if (!podio::mergeROOTFiles(inputFiles, outputFile, fastClone) && fastClone) {
+        std::cout << "podio-merge: Not all inputs have the same contents, read and wrote all Frames\n";
+      }
+#if PODIO_ENABLE_SIO
+    } else if (endsWith(outputFile, ".sio")) {
+      podio::mergeSIOFiles(inputFiles, outputFile);
+#endif
+    } else {
+      std::cerr << "podio-merge: Cannot determine the backend for output file " << outputFile << "\n";
+      return 1;
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << "podio-merge: " << ex.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,261 @@
+#include "podio/FrameSkimmer.h"
+#include "podio/GenericParameters.h"
+
+#include "podioToolsIO.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+using podio::tools::Format;
+
+/// The entries selected on the command line, either as a list or as an (inclusive) range
+struct EntrySelection {
+  std::vector<unsigned> entries{};
+  std::optional<std::pair<unsigned long, unsigned long>> range{};
+
+  /// Get the selected entries, where a range is clamped to the available entries
+  std::vector<unsigned> get(unsigned nEntries) const {
+    if (!range) {
+      return entries;
+    }
+    const auto [first, last] = range.value();
+    // Exclusive bound to not overflow for a last entry of ULONG_MAX
+    const auto end = last < nEntries ? last + 1 : nEntries;
+    std::vector<unsigned> selected;
+    for (auto entry = first; entry < end; ++entry) {
+      selected.push_back(static_cast<unsigned>(entry));
+    }
+    return selected;
+  }
+};
+
+struct Args {
+  std::string inputFile{};
+  std::string outputFile{};
+  std::optional<Format> outputFormat{};
+  std::optional<int> compression{};
+  std::string category{"events"};
+  std::optional<EntrySelection> entries{};
+  std::vector<std::pair<std::string, std::string>> parameters{};
+  std::vector<std::string> collections{};
+  bool addRelated{true};
+};
+
+void printUsage(std::ostream& os) {
+  os << "usage: podio-skim [-h] [-f {root,rntuple,sio}] [-c COMPRESSION] [--category CATEGORY]\n"
+        "                  [-e ENTRIES] [-p KEY=VALUE] [--collections NAMES] [--no-related]\n"
+        "                  INPUT OUTPUT\n\n"
+        "Write the selected entries and collections of one category of a podio file to a\n"
+        "new file. The buffers of the collections are written as they have been read,\n"
+        "i.e. without unpacking the collections.\n\n"
+        "positional arguments:\n"
+        "  INPUT                    the input file\n"
+        "  OUTPUT                   the output file\n\n"
+        "options:\n"
+        "  -h, --help               show this help message and exit\n"
+        "  -f, --format FORMAT      the output format: root (TTree based), rntuple or sio.\n"
+        "                           Determined from the output file extension by default\n"
+        "  -c, --compression N      the compression settings of the output file\n"
+        "  --category CATEGORY      the category to skim (default: events)\n"
+        "  -e, --entries ENTRIES    the entries to write, either a single entry, a comma\n"
+        "                           separated list or an inclusive range FIRST:LAST that\n"
+        "                           is limited to the available entries. All by default\n"
+        "  -p, --parameter KEY=VALUE\n"
+        "                           only write the entries with a parameter KEY that has\n"
+        "                           VALUE as one of its values. Can be given more than once,\n"
+        "                           in which case all of them have to match\n"
+        "  --collections NAMES      comma separated list of the collections to write. All\n"
+        "                           collections by default\n"
+        "  --no-related             do not automatically write the collections that the\n"
+        "                           selected collections point to via their relations\n";
+}
+
+std::vector<std::string> splitString(const std::string& str, char delimiter) {
+  std::vector<std::string> tokens;
+  std::stringstream sstream(str);
+  std::string token;
+  while (std::getline(sstream, token, delimiter)) {
+    tokens.emplace_back(std::move(token));
+  }
+  return tokens;
+}
+
+/// Parse the entries in the same way as podio-dump
+EntrySelection parseEntries(const std::string& entriesStr) {
+  if (const auto colon = entriesStr.find(':'); colon != std::string::npos) {
+    return {{}, std::make_pair(std::stoul(entriesStr.substr(0, colon)), std::stoul(entriesStr.substr(colon + 1)))};
+  }
+
+  EntrySelection selection{};
+  for (const auto& entryStr : splitString(entriesStr, ',')) {
+    const auto entry = std::stoul(entryStr);
+    if (entry > std::numeric_limits<unsigned>::max()) {
+      throw std::out_of_range("entry number out of range");
+    }
+    selection.entries.push_back(static_cast<unsigned>(entry));
+  }
+  return selection;
+}
+
+template <typename T>
+bool hasValue(const podio::GenericParameters& params, const std::string& key, const std::string& value) {
+  if (params.getN<T>(key) == 0) {
+    return false;
+  }
+  const auto& values = params.getValue<std::vector<T>>(key);
+  try {
+    if constexpr (std::is_same_v<T, int>) {
+      return std::find(values.begin(), values.end(), std::stoi(value)) != values.end();
+    } else if constexpr (std::is_same_v<T, float>) {
+      return std::find(values.begin(), values.end(), std::stof(value)) != values.end();
+    } else if constexpr (std::is_same_v<T, double>) {
+      return std::find(values.begin(), values.end(), std::stod(value)) != values.end();
+    } else {
+      return std::find(values.begin(), values.end(), value) != values.end();
+    }
+  } catch (const std::logic_error&) {
+    // The value cannot be parsed into the type of the parameter
+    return false;
+  }
+}
+
+bool hasParameterValue(const podio::GenericParameters& params, const std::string& key, const std::string& value) {
+  return hasValue<int>(params, key, value) || hasValue<float>(params, key, value) ||
+      hasValue<double>(params, key, value) || hasValue<std::string>(params, key, value);
+}
+
+std::optional<Args> parseArgs(int argc, char* argv[]) {
+  Args args{};
+  std::vector<std::string> positional{};
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      printUsage(std::cout);
+      std::exit(0);
+    } else if (arg == "--no-related") {
+      args.addRelated = false;
+      continue;
+    }
+
+    if (arg == "-f" || arg == "--format" || arg == "-c" || arg == "--compression" || arg == "--category" ||
+        arg == "-e" || arg == "--entries" || arg == "-p" || arg == "--parameter" || arg == "--collections") {
+      if (++i == argc) {
+        std::cerr << "podio-skim: " << arg << " requires an argument\n";
+        return std::nullopt;
+      }
+      const std::string value = argv[i];
+      try {
+        if (arg == "-f" || arg == "--format") {
+          args.outputFormat = podio::tools::parseFormat(value);
+          if (!args.outputFormat) {
+            std::cerr << "podio-skim: invalid format '" << value << "'\n";
+            return std::nullopt;
+          }
+        } else if (arg == "-c" || arg == "--compression") {
+          args.compression = std::stoi(value);
+        } else if (arg == "--category") {
+          args.category = value;
+        } else if (arg == "-e" || arg == "--entries") {
+          args.entries = parseEntries(value);
+        } else if (arg == "-p" || arg == "--parameter") {
+          const auto equals = value.find('=');
+          if (equals == std::string::npos) {
+            std::cerr << "podio-skim: invalid parameter selection '" << value << "', expected KEY=VALUE\n";
+            return std::nullopt;
+          }
+          args.parameters.emplace_back(value.substr(0, equals), value.substr(equals + 1));
+        } else {
+          args.collections = splitString(value, ',');
+        }
+      } catch (const std::logic_error&) {
+        std::cerr << "podio-skim: invalid value '" << value << "' for " << arg << "\n";
+        return std::nullopt;
+      }
+    } else if (!arg.empty() && arg.front() == '-') {
+      std::cerr << "podio-skim: unrecognized argument " << arg << "\n";
+      return std::nullopt;
+    } else {
+      positional.emplace_back(arg);
+    }
+  }
+
+  if (positional.size() != 2) {
+    return std::nullopt;
+  }
+  args.inputFile = positional[0];
+  args.outputFile = positional[1];
+
+  if (!args.outputFormat) {
+    args.outputFormat = podio::tools::getOutputFormat(args.outputFile);
+    if (!args.outputFormat) {
+      std::cerr << "podio-skim: Cannot determine the format for output file " << args.outputFile << "\n";
+      return std::nullopt;
+    }
+  }
+
+  return args;
+}
+
+template <typename ReaderT, typename WriterT>
+size_t skim(ReaderT& reader, WriterT& writer, const Args& args) {
+  const auto selected = args.entries ? args.entries->get(reader.getEntries(args.category)) : std::vector<unsigned>{};
+  // Only read the selected entries if that is all that is necessary
+  if (args.parameters.empty() && args.entries) {
+    return podio::skimFrames(reader, writer, args.category, selected, args.collections, args.addRelated);
+  }
+
+  const auto entries = std::set<unsigned>(selected.begin(), selected.end());
+  const auto selector = [&](unsigned entry, const podio::GenericParameters& params) {
+    if (args.entries && entries.count(entry) == 0) {
+      return false;
+    }
+    return std::all_of(args.parameters.begin(), args.parameters.end(), [&params](const auto& keyValue) {
+      return hasParameterValue(params, keyValue.first, keyValue.second);
+    });
+  };
+  return podio::skimFrames(reader, writer, args.category, selector, args.collections, args.addRelated);
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+  const auto args = parseArgs(argc, argv);
+  if (!args) {
+    printUsage(std::cerr);
+    return 1;
+  }
+
+  try {
+    const auto inputFormat = podio::tools::getInputFormat(args->inputFile);
+    if (!inputFormat) {
+      std::cerr << "podio-skim: Cannot determine the format of input file " << args->inputFile << "\n";
+      return 1;
+    }
+
+    const auto skimFile = [&](auto& reader) {
+      const auto write = [&](auto& writer) { return skim(reader, writer, args.value()); };
+      return podio::tools::withWriter(args->outputFormat.value(), args->outputFile, args->compression, write);
+    };
+    const auto nFrames = podio::tools::withReader(inputFormat.value(), args->inputFile, skimFile);
+    std::cout << "podio-skim: Wrote " << nFrames << " Frames of category '" << args->category << "' to "
+              << args->outputFile << "\n";
+  } catch (const std::exception& ex) {
+    std::cerr << "podio-skim: " << ex.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+#ifndef PODIO_TOOLS_PODIOTOOLSIO_H // NOLINT(llvm-header-guard): folder structure not suitable
+#define PODIO_TOOLS_PODIOTOOLSIO_H // NOLINT(llvm-header-guard): folder structure not suitable
+
+// Helpers for the command line tools that work with all available readers and
+// writers
+
+#include "podio/ROOTLegacyReader.h"
+#include "podio/ROOTReader.h"
+#include "podio/ROOTWriter.h"
+
+#ifndef PODIO_ENABLE_SIO
+  #define PODIO_ENABLE_SIO 0
+#endif
+#if PODIO_ENABLE_SIO
+  #include "podio/SIOLegacyReader.h"
+  #include "podio/SIOReader.h"
+  #include "podio/SIOWriter.h"
+#endif
+
+#if PODIO_ENABLE_RNTUPLE
+  #include "podio/RNTupleReader.h"
+  #include "podio/RNTupleWriter.h"
+#endif
+
+#include "TFile.h"
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace podio::tools {
+
+enum class Format { TTree, RNTuple, LegacyTTree, SIO, LegacySIO };
+
+inline bool endsWith(std::string_view str, std::string_view suffix) {
+  return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+}
+
+/// Parse the format of an output file as given on the command line
+inline std::optional<Format> parseFormat(std::string_view format) {
+  if (format == "root") {
+    return Format::TTree;
+  } else if (format == "rntuple") {
+    return Format::RNTuple;
+  } else if (format == "sio") {
+    return Format::SIO;
+  }
+  return std::nullopt;
+}
+
+/// Determine the format of an output file from its extension, where .root
+/// files are TTree based
+inline std::optional<Format> getOutputFormat(const std::string& filename) {
+  if (endsWith(filename, ".root")) {
+    return Format::TTree;
+  } else if (endsWith(filename, ".sio")) {
+    return Format::SIO;
+  }
+  return std::nullopt;
+}
+
+/// Determine the format of an existing file
+inline std::optional<Format> getInputFormat(const std::string& filename) {
+  if (endsWith(filename, ".sio")) {
+    // The SIOWriter writes a podio_header_info record at the beginning of the file
+    std::ifstream file(filename, std::ios::binary);
+    std::string firstLine{};
+    std::getline(file, firstLine);
+    return firstLine.find("podio_header_info") != std::string::npos ? Format::SIO : Format::LegacySIO;
+  }
+
+  if (endsWith(filename, ".root")) {
+    const auto file = std::unique_ptr<TFile>(TFile::Open(filename.c_str(), "READ"));
+    if (!file || file->IsZombie()) {
+      throw std::runtime_error("File " + filename + " couldn't be opened");
+    }
+    const auto* metadata = file->Get("podio_metadata");
+    if (!metadata) {
+      return Format::LegacyTTree;
+    }
+    return metadata->InheritsFrom("TTree") ? Format::TTree : Format::RNTuple;
+  }
+
+  return std::nullopt;
+}
+
+namespace detail {
+  template <typename ReaderT, typename Func>
+  size_t withReader(const std::string& filename, Func&& func) {
+    ReaderT reader{};
+    reader.openFile(filename);
+    return func(reader);
+  }
+
+  template <typename WriterT, typename Func>
+  size_t withWriter(const std::string& filename, std::optional<int> compression, Func&& func) {
+    auto writer = compression ? std::make_unique<WriterT>(filename, compression.value())
+                              : std::make_unique<WriterT>(filename);
+    const auto result = func(*writer);
+    writer->finish();
+    return result;
+  }
+} // namespace detail
+
+/// Open the file with a reader of the given format and call func with it
+template <typename Func>
+size_t withReader(Format format, const std::string& filename, Func&& func) {
+  switch (format) {
+  case Format::TTree:
+    return detail::withReader<podio::ROOTReader>(filename, func);
+  case Format::LegacyTTree:
+    return detail::withReader<podio::ROOTLegacyReader>(filename, func);
+#if PODIO_ENABLE_RNTUPLE
+  case Format::RNTuple:
+    return detail::withReader<podio::RNTupleReader>(filename, func);
+#endif
+#if PODIO_ENABLE_SIO
+  case Format::SIO:
+    return detail::withReader<podio::SIOReader>(filename, func);
+  case Format::LegacySIO:
+    return detail::withReader<podio::SIOLegacyReader>(filename, func);
+#endif
+  default:
+    throw std::runtime_error("podio has not been built with support for the format of input file " + filename);
+  }
+}
+
+/// Create a writer of the given format (with the default compression if none
+/// is passed), call func with it and finish writing afterwards
+template <typename Func>
+size_t withWriter(Format format, const std::string& filename, std::optional<int> compression, Func&& func) {
+  switch (format) {
+  case Format::TTree:
+    return detail::withWriter<podio::ROOTWriter>(filename, compression, func);
+#if PODIO_ENABLE_RNTUPLE
+  case Format::RNTuple:
+    return detail::withWriter<podio::RNTupleWriter>(filename, compression, func);
+#endif
+#if PODIO_ENABLE_SIO
+  case Format::SIO:
+    return detail::withWriter<podio::SIOWriter>(filename, compression, func);
+#endif
+  default:
+    throw std::runtime_error("podio has not been built with support for the format of output file " + filename);
+  }
+}
+
+} // namespace podio::tools
+
+#endif // PODIO_TOOLS_PODIOTOOLSIO_H